@@ -37,6 +37,9 @@ Function::Function(const ResultVector& results,
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
+    , m_edit_count(make_shared<atomic<size_t>>(0))
+    , m_ordered_ops_edit_count(0)
+    , m_ordered_ops_valid(false)
 {
     init();
 }
@@ -50,6 +53,9 @@ Function::Function(const NodeVector& results,
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
+    , m_edit_count(make_shared<atomic<size_t>>(0))
+    , m_ordered_ops_edit_count(0)
+    , m_ordered_ops_valid(false)
 {
     if (std::any_of(results.cbegin(), results.cend(), [](std::shared_ptr<Node> n) {
             return std::dynamic_pointer_cast<op::Result>(n);
@@ -89,9 +95,23 @@ void Function::init()
     });
 }
 
-std::list<shared_ptr<Node>> Function::get_ordered_ops()
+const std::list<shared_ptr<Node>>& Function::get_ordered_ops()
 {
-    return topological_sort(get_ops());
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    size_t edit_count = *m_edit_count;
+    if (m_ordered_ops_valid && m_ordered_ops_edit_count == edit_count)
+    {
+        return m_ordered_ops;
+    }
+
+    m_ordered_ops = topological_sort(get_ops());
+    for (const shared_ptr<Node>& node : m_ordered_ops)
+    {
+        node->add_edit_counter(m_edit_count);
+    }
+    m_ordered_ops_edit_count = edit_count;
+    m_ordered_ops_valid = true;
+    return m_ordered_ops;
 }
 
 const std::string& Function::get_friendly_name() const
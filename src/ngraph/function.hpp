@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -75,7 +76,12 @@ namespace ngraph
         //  an XLA or regular function
         void set_name(const std::string& name);
         std::list<std::shared_ptr<Node>> get_ops() const;
-        std::list<std::shared_ptr<Node>> get_ordered_ops();
+        /// Return the ops in topological order. The order is cached and only recomputed when
+        /// an input of one of this function's nodes has been rewired since the last call, so
+        /// edits to other functions leave it intact. The returned list is replaced (and the
+        /// nodes no longer in the graph released) by the next call after such an edit; copy it
+        /// to keep it across that call.
+        const std::list<std::shared_ptr<Node>>& get_ordered_ops();
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -96,5 +102,12 @@ namespace ngraph
         size_t m_instance_id;
         std::string m_name;
         const std::string m_unique_name;
+
+        // Bumped whenever an input of a node in m_ordered_ops is rewired
+        std::shared_ptr<std::atomic<size_t>> m_edit_count;
+        std::list<std::shared_ptr<Node>> m_ordered_ops;
+        size_t m_ordered_ops_edit_count;
+        bool m_ordered_ops_valid;
+        std::mutex m_ordered_ops_mutex;
     };
 }
@@ -72,6 +72,39 @@ void Node::add_output(const element::Type& element_type, const Shape& shape)
     m_outputs.emplace_back(this, i, tensor_view_descriptor);
 }
 
+void Node::add_edit_counter(const shared_ptr<atomic<size_t>>& counter)
+{
+    // Drop the counters of functions that no longer exist while looking for this one
+    bool registered = false;
+    auto it = m_edit_counters.begin();
+    while (it != m_edit_counters.end())
+    {
+        auto existing = it->lock();
+        if (!existing)
+        {
+            it = m_edit_counters.erase(it);
+            continue;
+        }
+        registered = registered || existing == counter;
+        ++it;
+    }
+    if (!registered)
+    {
+        m_edit_counters.push_back(counter);
+    }
+}
+
+void Node::notify_input_replaced()
+{
+    for (const weak_ptr<atomic<size_t>>& edit_counter : m_edit_counters)
+    {
+        if (auto counter = edit_counter.lock())
+        {
+            (*counter)++;
+        }
+    }
+}
+
 void Node::set_value_type_checked(const shared_ptr<const TensorViewType>& value_type)
 {
     set_value_type_checked(value_type->get_element_type(), value_type->get_shape());
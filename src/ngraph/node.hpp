@@ -66,6 +66,7 @@ namespace ngraph
         // So Adjoints can call generate_adjoints
         friend class autodiff::Adjoints;
         friend class descriptor::Input;
+        friend class Function;
         friend void replace_node_users_arguments(std::shared_ptr<Node> target,
                                                  std::shared_ptr<Node> replacement);
         friend std::pair<std::shared_ptr<op::Result>, std::shared_ptr<op::Parameter>>
@@ -195,6 +196,11 @@ namespace ngraph
     protected:
         void add_output(const element::Type& element_type, const Shape& shape);
 
+        /// Register the edit counter of a function whose cached order contains this node
+        void add_edit_counter(const std::shared_ptr<std::atomic<size_t>>& counter);
+        /// Bump the edit counters of the functions whose cached order contains this node
+        void notify_input_replaced();
+
         std::string m_node_type;
         size_t m_instance_id;
         std::string m_name;
@@ -204,5 +210,6 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
+        std::vector<std::weak_ptr<std::atomic<size_t>>> m_edit_counters;
     };
 }
@@ -35,10 +35,13 @@ namespace ngraph
             /// `[d0, ...]`
             /// \param arg1 Node that produces the second input tensor.<br>
             /// `[d0, ...]`
+            /// \param autob Broadcasting rule for inputs of differing shapes.
             ///
             /// Output `[d0, ...]`
             ///
-            Add(const std::shared_ptr<Node>& arg0, const std::shared_ptr<Node>& arg1);
+            Add(const std::shared_ptr<Node>& arg0,
+                const std::shared_ptr<Node>& arg1,
+                AutoBroadcastType autob = AutoBroadcastType::NONE);
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
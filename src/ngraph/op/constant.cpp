@@ -71,6 +71,20 @@ vector<string> op::Constant::get_value_strings() const
             rc.push_back(to_string(value));
         }
     }
+    else if (m_element_type == element::f16)
+    {
+        for (float value : get_vector<float16>())
+        {
+            rc.push_back(to_cpp_string(value));
+        }
+    }
+    else if (m_element_type == element::bf16)
+    {
+        for (float value : get_vector<bfloat16>())
+        {
+            rc.push_back(to_cpp_string(value));
+        }
+    }
     else if (m_element_type == element::f32)
     {
         for (float value : get_vector<float>())
@@ -21,8 +21,10 @@
 using namespace std;
 using namespace ngraph;
 
-op::Divide::Divide(const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1)
-    : BinaryElementwiseArithmetic("Divide", arg0, arg1)
+op::Divide::Divide(const shared_ptr<Node>& arg0,
+                   const shared_ptr<Node>& arg1,
+                   AutoBroadcastType autob)
+    : BinaryElementwiseArithmetic("Divide", arg0, arg1, autob)
 {
 }
 
@@ -32,11 +34,16 @@ shared_ptr<Node> op::Divide::copy_with_new_args(const NodeVector& new_args) cons
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
-    return make_shared<Divide>(new_args.at(0), new_args.at(1));
+    return make_shared<Divide>(new_args.at(0), new_args.at(1), get_autob());
 }
 
 void op::Divide::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
+    if (get_autob() != AutoBroadcastType::NONE)
+    {
+        throw ngraph_error("Autodiff not supported with auto broadcasting");
+    }
+
     auto delta = deltas.at(0);
 
     auto x = get_argument(0);
@@ -43,7 +43,10 @@ namespace ngraph
             ///
             /// \param arg0 Node that produces the first input tensor.
             /// \param arg1 Node that produces the second input tensor.
-            Equal(const std::shared_ptr<Node>& arg0, const std::shared_ptr<Node>& arg1);
+            /// \param autob Broadcasting rule for inputs of differing shapes.
+            Equal(const std::shared_ptr<Node>& arg0,
+                  const std::shared_ptr<Node>& arg1,
+                  AutoBroadcastType autob = AutoBroadcastType::NONE);
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
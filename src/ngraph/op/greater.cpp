@@ -19,8 +19,10 @@
 using namespace std;
 using namespace ngraph;
 
-op::Greater::Greater(const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1)
-    : BinaryElementwiseComparison("Greater", arg0, arg1)
+op::Greater::Greater(const shared_ptr<Node>& arg0,
+                     const shared_ptr<Node>& arg1,
+                     AutoBroadcastType autob)
+    : BinaryElementwiseComparison("Greater", arg0, arg1, autob)
 {
 }
 
@@ -30,5 +32,5 @@ shared_ptr<Node> op::Greater::copy_with_new_args(const NodeVector& new_args) con
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
-    return make_shared<Greater>(new_args.at(0), new_args.at(1));
+    return make_shared<Greater>(new_args.at(0), new_args.at(1), get_autob());
 }
@@ -19,8 +19,10 @@
 using namespace std;
 using namespace ngraph;
 
-op::Less::Less(const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1)
-    : BinaryElementwiseComparison("Less", arg0, arg1)
+op::Less::Less(const shared_ptr<Node>& arg0,
+               const shared_ptr<Node>& arg1,
+               AutoBroadcastType autob)
+    : BinaryElementwiseComparison("Less", arg0, arg1, autob)
 {
 }
 
@@ -30,5 +32,5 @@ shared_ptr<Node> op::Less::copy_with_new_args(const NodeVector& new_args) const
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
-    return make_shared<Less>(new_args.at(0), new_args.at(1));
+    return make_shared<Less>(new_args.at(0), new_args.at(1), get_autob());
 }
@@ -25,8 +25,10 @@
 using namespace std;
 using namespace ngraph;
 
-op::Maximum::Maximum(const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1)
-    : BinaryElementwiseArithmetic("Maximum", arg0, arg1)
+op::Maximum::Maximum(const shared_ptr<Node>& arg0,
+                     const shared_ptr<Node>& arg1,
+                     AutoBroadcastType autob)
+    : BinaryElementwiseArithmetic("Maximum", arg0, arg1, autob)
 {
 }
 
@@ -36,11 +38,16 @@ shared_ptr<Node> op::Maximum::copy_with_new_args(const NodeVector& new_args) con
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
-    return make_shared<Maximum>(new_args.at(0), new_args.at(1));
+    return make_shared<Maximum>(new_args.at(0), new_args.at(1), get_autob());
 }
 
 void op::Maximum::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
+    if (get_autob() != AutoBroadcastType::NONE)
+    {
+        throw ngraph_error("Autodiff not supported with auto broadcasting");
+    }
+
     auto delta = deltas.at(0);
 
     auto x = get_argument(0);
@@ -25,8 +25,10 @@
 using namespace std;
 using namespace ngraph;
 
-op::Minimum::Minimum(const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1)
-    : BinaryElementwiseArithmetic("Minimum", arg0, arg1)
+op::Minimum::Minimum(const shared_ptr<Node>& arg0,
+                     const shared_ptr<Node>& arg1,
+                     AutoBroadcastType autob)
+    : BinaryElementwiseArithmetic("Minimum", arg0, arg1, autob)
 {
 }
 
@@ -36,11 +38,16 @@ shared_ptr<Node> op::Minimum::copy_with_new_args(const NodeVector& new_args) con
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
-    return make_shared<Minimum>(new_args.at(0), new_args.at(1));
+    return make_shared<Minimum>(new_args.at(0), new_args.at(1), get_autob());
 }
 
 void op::Minimum::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
+    if (get_autob() != AutoBroadcastType::NONE)
+    {
+        throw ngraph_error("Autodiff not supported with auto broadcasting");
+    }
+
     auto delta = deltas.at(0);
 
     auto x = get_argument(0);
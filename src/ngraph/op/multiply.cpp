@@ -19,8 +19,10 @@
 using namespace std;
 using namespace ngraph;
 
-op::Multiply::Multiply(const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1)
-    : BinaryElementwiseArithmetic("Multiply", arg0, arg1)
+op::Multiply::Multiply(const shared_ptr<Node>& arg0,
+                       const shared_ptr<Node>& arg1,
+                       AutoBroadcastType autob)
+    : BinaryElementwiseArithmetic("Multiply", arg0, arg1, autob)
 {
 }
 
@@ -30,11 +32,16 @@ shared_ptr<Node> op::Multiply::copy_with_new_args(const NodeVector& new_args) co
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
-    return make_shared<Multiply>(new_args.at(0), new_args.at(1));
+    return make_shared<Multiply>(new_args.at(0), new_args.at(1), get_autob());
 }
 
 void op::Multiply::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
+    if (get_autob() != AutoBroadcastType::NONE)
+    {
+        throw ngraph_error("Autodiff not supported with auto broadcasting");
+    }
+
     auto delta = deltas.at(0);
 
     auto x = get_argument(0);
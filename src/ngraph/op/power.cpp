@@ -22,8 +22,10 @@
 using namespace std;
 using namespace ngraph;
 
-op::Power::Power(const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1)
-    : BinaryElementwiseArithmetic("Power", arg0, arg1)
+op::Power::Power(const shared_ptr<Node>& arg0,
+                 const shared_ptr<Node>& arg1,
+                 AutoBroadcastType autob)
+    : BinaryElementwiseArithmetic("Power", arg0, arg1, autob)
 {
 }
 
@@ -33,11 +35,16 @@ shared_ptr<Node> op::Power::copy_with_new_args(const NodeVector& new_args) const
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
-    return make_shared<Power>(new_args.at(0), new_args.at(1));
+    return make_shared<Power>(new_args.at(0), new_args.at(1), get_autob());
 }
 
 void op::Power::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
 {
+    if (get_autob() != AutoBroadcastType::NONE)
+    {
+        throw ngraph_error("Autodiff not supported with auto broadcasting");
+    }
+
     auto delta = deltas.at(0);
 
     auto x = get_argument(0);
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/unary_elementwise.hpp"
+#include "ngraph/type/type.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Elementwise affine quantization of an f32 tensor to an integer type.
+        ///
+        /// Each element is computed as \f$\mathit{clamp}(\mathit{round}(x / \mathit{scale}) +
+        /// \mathit{zero\_point})\f$, where rounding is to nearest even and the clamp saturates to
+        /// the range of the output element type.
+        class Quantize : public util::UnaryElementwise
+        {
+        public:
+            /// \brief Constructs a quantize operation.
+            ///
+            /// \param arg          Node that produces the f32 input tensor.
+            /// \param scale        Real value represented by one quantization step. Must be positive.
+            /// \param zero_point   Quantized value that represents the real value zero.
+            /// \param element_type Element type for the output tensor; one of u8, i8 or i32.
+            Quantize(const std::shared_ptr<Node>& arg,
+                     float scale,
+                     int64_t zero_point,
+                     const ngraph::element::Type& element_type);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            float get_scale() const { return m_scale; }
+            int64_t get_zero_point() const { return m_zero_point; }
+            const element::Type& get_quantize_element_type() const { return m_element_type; }
+        protected:
+            const float m_scale;
+            const int64_t m_zero_point;
+            const ngraph::element::Type m_element_type;
+        };
+    }
+}
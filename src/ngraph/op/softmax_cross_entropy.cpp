@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/op/softmax_cross_entropy.hpp"
+
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Checks the logits and labels agree, and turns empty axes into all axes
+static AxisSet validate_softmax_cross_entropy(const Node& node, const AxisSet& axes)
+{
+    if (node.get_input_element_type(0) != node.get_input_element_type(1))
+    {
+        throw ngraph_error("Softmax cross-entropy: logits and labels element types do not match");
+    }
+    auto& shape = node.get_input_shape(0);
+    if (shape != node.get_input_shape(1))
+    {
+        throw ngraph_error("Softmax cross-entropy: logits and labels shapes do not match");
+    }
+
+    AxisSet result = axes;
+    for (auto axis : result)
+    {
+        if (axis >= shape.size())
+        {
+            throw ngraph_error("Axis for softmax cross-entropy is out of bounds");
+        }
+    }
+    if (result.empty())
+    {
+        for (size_t i = 0; i < shape.size(); ++i)
+        {
+            result.insert(i);
+        }
+    }
+    return result;
+}
+
+op::SoftmaxCrossEntropy::SoftmaxCrossEntropy(const shared_ptr<Node>& logits,
+                                             const shared_ptr<Node>& labels,
+                                             const AxisSet& axes)
+    : RequiresTensorViewArgs("SoftmaxCrossEntropy", {logits, labels})
+{
+    m_axes = validate_softmax_cross_entropy(*this, axes);
+    set_value_type_checked(get_input_element_type(0), project(get_input_shape(0), m_axes));
+}
+
+shared_ptr<Node> op::SoftmaxCrossEntropy::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<SoftmaxCrossEntropy>(new_args.at(0), new_args.at(1), m_axes);
+}
+
+void op::SoftmaxCrossEntropy::generate_adjoints(autodiff::Adjoints& adjoints,
+                                                const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+
+    auto logits = get_argument(0);
+    auto labels = get_argument(1);
+    adjoints.add_delta(logits,
+                       make_shared<op::SoftmaxCrossEntropyBackprop>(logits, labels, delta, m_axes));
+
+    // The labels are rarely trained, but their gradient is -delta * log(softmax(logits)), with
+    // the log-softmax shifted by the maximum so exp can't overflow
+    auto& shape = logits->get_shape();
+    auto max = make_shared<op::Broadcast>(make_shared<op::Max>(logits, m_axes), shape, m_axes);
+    auto shifted = logits - max;
+    auto sum = make_shared<op::Sum>(make_shared<op::Exp>(shifted), m_axes);
+    auto log_softmax =
+        shifted - make_shared<op::Broadcast>(make_shared<op::Log>(sum), shape, m_axes);
+    adjoints.add_delta(labels, -(make_shared<op::Broadcast>(delta, shape, m_axes) * log_softmax));
+}
+
+op::SoftmaxCrossEntropyBackprop::SoftmaxCrossEntropyBackprop(const shared_ptr<Node>& logits,
+                                                             const shared_ptr<Node>& labels,
+                                                             const shared_ptr<Node>& delta,
+                                                             const AxisSet& axes)
+    : RequiresTensorViewArgs("SoftmaxCrossEntropyBackprop", {logits, labels, delta})
+{
+    m_axes = validate_softmax_cross_entropy(*this, axes);
+    if (get_input_element_type(2) != get_input_element_type(0))
+    {
+        throw ngraph_error("Softmax cross-entropy backprop: delta element type does not match");
+    }
+    if (get_input_shape(2) != project(get_input_shape(0), m_axes))
+    {
+        throw ngraph_error("Softmax cross-entropy backprop: delta shape does not match the loss");
+    }
+    set_value_type_checked(get_input_element_type(0), get_input_shape(0));
+}
+
+shared_ptr<Node>
+    op::SoftmaxCrossEntropyBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<SoftmaxCrossEntropyBackprop>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_axes);
+}
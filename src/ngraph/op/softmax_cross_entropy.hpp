@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Cross-entropy of the softmax of logits against labels, computed with
+        ///        log-sum-exp rather than by taking the log of the softmax.
+        ///
+        /// \f$-\sum_{axes} labels \cdot \log(softmax(logits))\f$
+        class SoftmaxCrossEntropy : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a softmax cross-entropy operation.
+            ///
+            /// \param logits Node that produces the logits.<br>
+            /// `[d0, ...]`
+            /// \param labels Node that produces the labels, usually a probability distribution
+            ///               over the axes.<br>
+            /// `[d0, ...]`
+            /// \param axes The axis positions (0-based) the softmax is taken over. Empty means all
+            ///             axes.
+            ///
+            /// Output `[d0, ...]` with the axes removed
+            SoftmaxCrossEntropy(const std::shared_ptr<Node>& logits,
+                                const std::shared_ptr<Node>& labels,
+                                const AxisSet& axes);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const AxisSet& get_axes() const { return m_axes; }
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+        private:
+            AxisSet m_axes;
+        };
+
+        /// \brief Gradient of SoftmaxCrossEntropy with respect to the logits,
+        ///        \f$delta \cdot (softmax(logits) \cdot \sum_{axes} labels - labels)\f$, which is
+        ///        the familiar softmax - labels when the labels sum to one.
+        class SoftmaxCrossEntropyBackprop : public util::RequiresTensorViewArgs
+        {
+        public:
+            SoftmaxCrossEntropyBackprop(const std::shared_ptr<Node>& logits,
+                                        const std::shared_ptr<Node>& labels,
+                                        const std::shared_ptr<Node>& delta,
+                                        const AxisSet& axes);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const AxisSet& get_axes() const { return m_axes; }
+        private:
+            AxisSet m_axes;
+        };
+    }
+}
@@ -14,10 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <memory>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -25,15 +27,50 @@ using namespace ngraph;
 op::util::BinaryElementwise::BinaryElementwise(const std::string& node_type,
                                                const element::Type& result_element_type,
                                                const std::shared_ptr<Node>& arg0,
-                                               const std::shared_ptr<Node>& arg1)
+                                               const std::shared_ptr<Node>& arg1,
+                                               AutoBroadcastType autob)
     : RequiresTensorViewArgs(node_type, NodeVector{arg0, arg1})
+    , m_autob(autob)
 {
     auto& input_0 = get_inputs().at(0);
     auto& input_1 = get_inputs().at(1);
-    if (input_0.get_shape() != input_1.get_shape())
+    Shape result_shape = broadcast_shape(input_0.get_shape(), input_1.get_shape(), m_autob);
+
+    set_value_type_checked(make_shared<TensorViewType>(result_element_type, result_shape));
+}
+
+bool op::util::BinaryElementwise::is_implicitly_broadcast() const
+{
+    return get_input_shape(0) != get_input_shape(1);
+}
+
+Shape op::util::BinaryElementwise::broadcast_shape(const Shape& arg0_shape,
+                                                   const Shape& arg1_shape,
+                                                   AutoBroadcastType autob)
+{
+    if (arg0_shape == arg1_shape)
+    {
+        return arg0_shape;
+    }
+    if (autob == AutoBroadcastType::NONE)
     {
         throw ngraph_error("Arguments must have the same tensor view shape");
     }
 
-    set_value_type_checked(make_shared<TensorViewType>(result_element_type, input_0.get_shape()));
+    // Numpy rules: right-align the shapes, then each pair of dimensions must match or one of
+    // them must be 1.
+    size_t rank = max(arg0_shape.size(), arg1_shape.size());
+    Shape result(rank);
+    for (size_t i = 0; i < rank; i++)
+    {
+        size_t d0 = i < arg0_shape.size() ? arg0_shape[arg0_shape.size() - 1 - i] : 1;
+        size_t d1 = i < arg1_shape.size() ? arg1_shape[arg1_shape.size() - 1 - i] : 1;
+        if (d0 != d1 && d0 != 1 && d1 != 1)
+        {
+            throw ngraph_error("Argument shapes " + vector_to_string(arg0_shape) + " and " +
+                               vector_to_string(arg1_shape) + " are not broadcast-compatible");
+        }
+        result[rank - 1 - i] = (d0 == 1 ? d1 : d0);
+    }
+    return result;
 }
@@ -22,6 +22,17 @@ namespace ngraph
 {
     namespace op
     {
+        /// \brief Broadcasting rule applied by binary elementwise operations to inputs of
+        ///        differing shapes.
+        enum class AutoBroadcastType
+        {
+            /// \brief Inputs must have identical shapes.
+            NONE = 0,
+            /// \brief Numpy-style broadcasting: shapes are right-aligned, and each pair of
+            ///        dimensions must either be equal or have one side equal to 1.
+            NUMPY
+        };
+
         namespace util
         {
             /// \brief Abstract base class for elementwise binary operations, i.e., operations where the same
@@ -38,6 +49,9 @@ namespace ngraph
             /// | `arg0` | \f$E_0[d_1,\dots,d_n]~(n \geq 0)\f$ | A tensor of any shape. Subclasses may impose restrictions on the element type \f$E_0\f$.                |
             /// | `arg1` | \f$E_1[d_1,\dots,d_n]~(n \geq 0)\f$ | A tensor of the same shape as `arg0`. Subclasses may impose restrictions on the element type \f$E_1\f$. |
             ///
+            /// If the operation is constructed with `AutoBroadcastType::NUMPY`, the input shapes only need
+            /// to be numpy-compatible, and the output has the broadcast shape of the two inputs.
+            ///
             /// ## Output
             ///
             /// | Type                     | Description                                                                                                                                                                                                                                                                                             |
@@ -45,15 +59,33 @@ namespace ngraph
             /// | \f$E_2[d_1,\dots,d_n]\f$ | The tensor \f$T\f$, where \f$T[i_1,\dots,i_n] = \mathit{op}(\texttt{arg0}[i_1,\dots,i_n],\texttt{arg1}[i_1,\dots,i_n])\f$. This will always have the same shape as the input tensors, but subclasses must determine the element type \f$E_2\f$. |
             class BinaryElementwise : public RequiresTensorViewArgs
             {
+            public:
+                /// \return The broadcasting rule applied to the inputs.
+                AutoBroadcastType get_autob() const { return m_autob; }
+                /// \return True if the input shapes differ, i.e. at least one input is read
+                ///         through implicit broadcasting.
+                bool is_implicitly_broadcast() const;
+
+                /// \brief Computes the shape produced by broadcasting two shapes together.
+                ///
+                /// \throws ngraph_error if the shapes are not compatible under \p autob.
+                static Shape broadcast_shape(const Shape& arg0_shape,
+                                             const Shape& arg1_shape,
+                                             AutoBroadcastType autob);
+
             protected:
                 /// \brief Constructs a biary elementwise operation.
                 ///
                 /// \param arg0 Node that produces the first input tensor.
                 /// \param arg1 Node that produces the second input tensor.
+                /// \param autob Broadcasting rule for inputs of differing shapes.
                 BinaryElementwise(const std::string& node_type,
                                   const element::Type& result_element_type,
                                   const std::shared_ptr<Node>& arg0,
-                                  const std::shared_ptr<Node>& arg1);
+                                  const std::shared_ptr<Node>& arg1,
+                                  AutoBroadcastType autob = AutoBroadcastType::NONE);
+
+                AutoBroadcastType m_autob;
             };
         }
     }
@@ -22,8 +22,9 @@ using namespace ngraph;
 op::util::BinaryElementwiseArithmetic::BinaryElementwiseArithmetic(
     const std::string& node_type,
     const std::shared_ptr<Node>& arg0,
-    const std::shared_ptr<Node>& arg1)
-    : BinaryElementwise(node_type, arg0->get_element_type(), arg0, arg1)
+    const std::shared_ptr<Node>& arg1,
+    AutoBroadcastType autob)
+    : BinaryElementwise(node_type, arg0->get_element_type(), arg0, arg1, autob)
 {
     if (arg0->get_element_type() != arg1->get_element_type())
     {
@@ -50,9 +50,11 @@ namespace ngraph
                 ///
                 /// \param arg0 Node that produces the first input tensor.
                 /// \param arg1 Node that produces the second input tensor.
+                /// \param autob Broadcasting rule for inputs of differing shapes.
                 BinaryElementwiseArithmetic(const std::string& node_type,
                                             const std::shared_ptr<Node>& arg0,
-                                            const std::shared_ptr<Node>& arg1);
+                                            const std::shared_ptr<Node>& arg1,
+                                            AutoBroadcastType autob = AutoBroadcastType::NONE);
             };
         }
     }
@@ -21,8 +21,9 @@ using namespace ngraph;
 
 op::util::BinaryElementwiseComparison::BinaryElementwiseComparison(const string& node_type,
                                                                    const shared_ptr<Node>& arg0,
-                                                                   const shared_ptr<Node>& arg1)
-    : BinaryElementwise(node_type, element::boolean, arg0, arg1)
+                                                                   const shared_ptr<Node>& arg1,
+                                                                   AutoBroadcastType autob)
+    : BinaryElementwise(node_type, element::boolean, arg0, arg1, autob)
 {
     if (arg0->get_element_type() != arg1->get_element_type())
     {
@@ -16,15 +16,36 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 namespace ngraph
 {
     namespace op
     {
         namespace util
         {
+            /// \brief An output that may be written into the buffer of one of the op's inputs
+            struct oi_pair
+            {
+                size_t output;
+                size_t input;
+            };
+
             /// \brief Abstract base class for annotations added to graph ops
             class OpAnnotations
             {
+            public:
+                /// MemoryLayout places the output in the input's buffer when the op is the
+                /// last user of that input, so the kernel must work with the two aliased.
+                void add_in_place_oi_pair(const oi_pair& oi) { m_in_place_oi_pairs.push_back(oi); }
+                const std::vector<oi_pair>& get_in_place_oi_pairs() const
+                {
+                    return m_in_place_oi_pairs;
+                }
+
+            private:
+                std::vector<oi_pair> m_in_place_oi_pairs;
             };
         }
     }
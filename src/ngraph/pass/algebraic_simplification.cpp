@@ -26,6 +26,7 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -239,8 +240,8 @@ static bool simplify_log(std::shared_ptr<Node> n)
         if (auto exp = std::dynamic_pointer_cast<op::Exp>(div->get_argument(0)))
         {
             auto denom = div->get_argument(1);
-            auto diff = std::make_shared<op::Subtract>(exp->get_argument(0),
-                                                       std::make_shared<op::Log>(denom));
+            auto diff = std::make_shared<op::Subtract>(
+                exp->get_argument(0), std::make_shared<op::Log>(denom), div->get_autob());
             ngraph::replace_node(n, diff);
             return true;
         }
@@ -249,6 +250,54 @@ static bool simplify_log(std::shared_ptr<Node> n)
     return false;
 }
 
+// True if every value of `from` survives a round trip through `to`
+static bool is_lossless_conversion(const element::Type& from, const element::Type& to)
+{
+    if (from == to)
+    {
+        return true;
+    }
+    if (from.is_real() && to.is_real())
+    {
+        // f16 and bf16 both widen exactly into f32, f32 into f64
+        return to.bitwidth() >= 32 && to.bitwidth() > from.bitwidth();
+    }
+    if (!from.is_real() && !to.is_real())
+    {
+        if (from.is_signed() == to.is_signed())
+        {
+            return to.bitwidth() >= from.bitwidth();
+        }
+        return !from.is_signed() && to.bitwidth() > from.bitwidth();
+    }
+    return false;
+}
+
+//`simplify_convert` optimizes `convert(convert(x, T1), T0)` into `x` when x is already T0 and
+// T1 represents every T0 value, e.g. the bf16->f32->bf16 pairs left between mixed precision ops
+static bool simplify_convert(std::shared_ptr<Node> n)
+{
+    auto x = n->get_argument(0);
+    if (x->get_element_type() == n->get_element_type())
+    {
+        ngraph::replace_node(n, x);
+        return true;
+    }
+
+    if (auto inner = std::dynamic_pointer_cast<op::Convert>(x))
+    {
+        auto source = inner->get_argument(0);
+        if (source->get_element_type() == n->get_element_type() &&
+            is_lossless_conversion(source->get_element_type(), inner->get_element_type()))
+        {
+            ngraph::replace_node(n, source);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static size_t reduction_shape_size(const AxisSet& axes, const Shape& shape)
 {
     size_t prod = 1;
@@ -384,6 +433,7 @@ static std::unordered_map<std::type_index, std::function<bool(std::shared_ptr<No
         {{TI(op::Add), simplify_add},
          {TI(op::Multiply), simplify_multiply},
          {TI(op::Concat), simplify_concat},
+         {TI(op::Convert), simplify_convert},
          {TI(op::Sum),
           std::function<bool(std::shared_ptr<Node>)>{
               simplify_reduction<op::Sum, get_sum_constant>}},
@@ -413,6 +463,13 @@ bool ngraph::pass::AlgebraicSimplification::run_on_function(std::shared_ptr<ngra
             continue;
         }
 
+        // The simplifications assume both arguments already have the output shape
+        auto binop = std::dynamic_pointer_cast<op::util::BinaryElementwise>(n);
+        if (binop && binop->is_implicitly_broadcast())
+        {
+            continue;
+        }
+
         replaced = eh->second(n) || replaced;
     }
     return replaced;
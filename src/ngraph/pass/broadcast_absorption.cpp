@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <functional>
+#include <numeric>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/equal.hpp"
+#include "ngraph/op/greater.hpp"
+#include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/less.hpp"
+#include "ngraph/op/less_eq.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/not_equal.hpp"
+#include "ngraph/op/or.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/pass/broadcast_absorption.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+using NumpyBroadcastFactory =
+    function<shared_ptr<Node>(const shared_ptr<Node>&, const shared_ptr<Node>&)>;
+
+template <typename T>
+static NumpyBroadcastFactory numpy_broadcast_factory()
+{
+    return [](const shared_ptr<Node>& arg0, const shared_ptr<Node>& arg1) {
+        return make_shared<T>(arg0, arg1, op::AutoBroadcastType::NUMPY);
+    };
+}
+
+static const unordered_map<type_index, NumpyBroadcastFactory> numpy_broadcast_ops{
+    {TI(op::Add), numpy_broadcast_factory<op::Add>()},
+    {TI(op::And), numpy_broadcast_factory<op::And>()},
+    {TI(op::Divide), numpy_broadcast_factory<op::Divide>()},
+    {TI(op::Equal), numpy_broadcast_factory<op::Equal>()},
+    {TI(op::Greater), numpy_broadcast_factory<op::Greater>()},
+    {TI(op::GreaterEq), numpy_broadcast_factory<op::GreaterEq>()},
+    {TI(op::Less), numpy_broadcast_factory<op::Less>()},
+    {TI(op::LessEq), numpy_broadcast_factory<op::LessEq>()},
+    {TI(op::Maximum), numpy_broadcast_factory<op::Maximum>()},
+    {TI(op::Minimum), numpy_broadcast_factory<op::Minimum>()},
+    {TI(op::Multiply), numpy_broadcast_factory<op::Multiply>()},
+    {TI(op::NotEqual), numpy_broadcast_factory<op::NotEqual>()},
+    {TI(op::Or), numpy_broadcast_factory<op::Or>()},
+    {TI(op::Power), numpy_broadcast_factory<op::Power>()},
+    {TI(op::Subtract), numpy_broadcast_factory<op::Subtract>()}};
+
+// The argument of `broadcast`, shaped so that it lines up with the broadcast output under
+// numpy rules: broadcast axes become unit dimensions, and leading ones are dropped
+static shared_ptr<Node> numpy_broadcast_arg(const shared_ptr<op::Broadcast>& broadcast)
+{
+    auto arg = broadcast->get_argument(0);
+    const Shape& out_shape = broadcast->get_shape();
+    const AxisSet& axes = broadcast->get_broadcast_axes();
+    Shape shape;
+    for (size_t axis = 0; axis < out_shape.size(); axis++)
+    {
+        if (axes.count(axis) == 0)
+        {
+            shape.push_back(out_shape[axis]);
+        }
+        else if (!shape.empty())
+        {
+            shape.push_back(1);
+        }
+    }
+    if (shape == arg->get_shape())
+    {
+        return arg;
+    }
+    AxisVector order(arg->get_shape().size());
+    iota(order.begin(), order.end(), 0);
+    return make_shared<op::Reshape>(arg, order, shape);
+}
+
+bool pass::BroadcastAbsorption::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (auto n : f->get_ordered_ops())
+    {
+        auto factory = numpy_broadcast_ops.find(TI(*n));
+        if (factory == numpy_broadcast_ops.end())
+        {
+            continue;
+        }
+
+        NodeVector args = n->get_arguments();
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            auto broadcast = dynamic_pointer_cast<op::Broadcast>(args[i]);
+            auto& other = args[1 - i];
+            if (broadcast && broadcast->get_shape() == n->get_shape() &&
+                other->get_shape() == n->get_shape())
+            {
+                NGRAPH_DEBUG << "Absorbing " << broadcast->get_name() << " into "
+                             << n->get_name();
+                args[i] = numpy_broadcast_arg(broadcast);
+                replace_node(n, factory->second(args[0], args[1]));
+                replaced = true;
+                break;
+            }
+        }
+    }
+    return replaced;
+}
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class BroadcastAbsorption;
+    }
+}
+
+/// \brief Folds explicit Broadcasts into the binary elementwise ops that consume them.
+///
+/// `Add(x, Broadcast(b))` becomes `Add(x, b')` with numpy-style auto broadcasting, where `b'`
+/// is `b` (reshaped if needed so that its broadcast axes are unit dimensions). The consumer
+/// then reads the small tensor with zero strides, and the Broadcast disappears once no other
+/// op uses it. A Broadcast is only absorbed when the other argument already has the output
+/// shape, so the consumer's output shape never changes.
+class ngraph::pass::BroadcastAbsorption : public ngraph::pass::FunctionPass
+{
+public:
+    BroadcastAbsorption()
+        : FunctionPass()
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/pass/calibrated_quantization.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+pass::CalibratedQuantization::CalibratedQuantization(
+    const vector<runtime::ActivationRange>& ranges)
+{
+    for (const runtime::ActivationRange& range : ranges)
+    {
+        m_ranges[range.name()] = range;
+    }
+}
+
+bool pass::CalibratedQuantization::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    m_data_inputs.clear();
+    for (shared_ptr<Node> n : f->get_ordered_ops())
+    {
+        if (n->get_element_type() != element::f32 ||
+            !(dynamic_pointer_cast<op::Convolution>(n) || dynamic_pointer_cast<op::Dot>(n)))
+        {
+            continue;
+        }
+
+        shared_ptr<Node> data = quantize_input(n->get_argument(0), false);
+        shared_ptr<Node> weights = quantize_input(n->get_argument(1), true);
+        if (!data || !weights)
+        {
+            continue;
+        }
+        n->get_inputs().at(0).replace_output(data, 0);
+        n->get_inputs().at(1).replace_output(weights, 0);
+        replaced = true;
+    }
+    m_data_inputs.clear();
+    return replaced;
+}
+
+shared_ptr<Node> pass::CalibratedQuantization::quantize_input(const shared_ptr<Node>& arg,
+                                                              bool is_weights)
+{
+    if (dynamic_pointer_cast<op::Dequantize>(arg))
+    {
+        // Already quantized
+        return nullptr;
+    }
+
+    auto it = m_data_inputs.find(arg);
+    if (!is_weights && it != m_data_inputs.end())
+    {
+        return it->second;
+    }
+
+    auto constant = dynamic_pointer_cast<op::Constant>(arg);
+    vector<float> values;
+    float min_value;
+    float max_value;
+    if (constant)
+    {
+        values = constant->get_vector<float>();
+        if (values.empty())
+        {
+            return nullptr;
+        }
+        auto range = minmax_element(values.begin(), values.end());
+        min_value = *range.first;
+        max_value = *range.second;
+    }
+    else
+    {
+        auto range = m_ranges.find(arg->get_name());
+        if (range == m_ranges.end() || range->second.call_count() == 0)
+        {
+            return nullptr;
+        }
+        min_value = range->second.min();
+        max_value = range->second.max();
+    }
+
+    bool is_unsigned = !is_weights && min_value >= 0.0f;
+    element::Type type = is_unsigned ? element::u8 : element::i8;
+    float limit = is_unsigned ? numeric_limits<uint8_t>::max() : numeric_limits<int8_t>::max();
+    float scale = std::max(fabs(min_value), fabs(max_value)) / limit;
+    if (!(scale > 0.0f) || !isfinite(scale))
+    {
+        return nullptr;
+    }
+
+    shared_ptr<Node> quantized;
+    if (constant && is_weights)
+    {
+        vector<int8_t> quantized_values(values.size());
+        runtime::reference::quantize<float, int8_t>(
+            values.data(), quantized_values.data(), values.size(), scale, 0);
+        quantized = make_shared<op::Constant>(element::i8, arg->get_shape(), quantized_values);
+    }
+    else
+    {
+        quantized = make_shared<op::Quantize>(arg, scale, 0, type);
+    }
+    auto dequantized = make_shared<op::Dequantize>(quantized, scale, 0);
+    if (!is_weights)
+    {
+        m_data_inputs[arg] = dequantized;
+    }
+    return dequantized;
+}
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/activation_range.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class CalibratedQuantization;
+    }
+}
+
+/// \brief Attaches calibrated quantization parameters to a graph.
+///
+/// Every f32 Convolution and Dot gets its data input routed through Quantize -> Dequantize and
+/// its weights stored as i8 followed by Dequantize. Scales are symmetric (zero point 0) and
+/// derived from the activation ranges recorded by Backend::get_activation_ranges; data whose
+/// recorded minimum is non-negative is quantized to u8, everything else to i8. Constant
+/// weights are quantized at compile time from their own values. Inputs without a recorded
+/// range are left in f32. The resulting pattern is what backends fuse into int8 kernels.
+class ngraph::pass::CalibratedQuantization : public ngraph::pass::FunctionPass
+{
+public:
+    CalibratedQuantization(const std::vector<runtime::ActivationRange>& ranges);
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    std::shared_ptr<Node> quantize_input(const std::shared_ptr<Node>& arg, bool is_weights);
+
+    std::unordered_map<std::string, runtime::ActivationRange> m_ranges;
+    std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_data_inputs;
+};
@@ -0,0 +1,344 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdexcept>
+#include <vector>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/runtime/reference/abs.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/maximum.hpp"
+#include "ngraph/runtime/reference/minimum.hpp"
+#include "ngraph/runtime/reference/multiply.hpp"
+#include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/sqrt.hpp"
+#include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using ConstantVector = vector<shared_ptr<op::Constant>>;
+
+// Calls F<T>::fold for the C++ type T matching `type`
+template <template <typename> class F>
+static shared_ptr<op::Constant>
+    dispatch(const element::Type& type, const shared_ptr<Node>& node, const ConstantVector& args)
+{
+    if (type == element::boolean)
+    {
+        return F<char>::fold(node, args);
+    }
+    else if (type == element::f16)
+    {
+        return F<float16>::fold(node, args);
+    }
+    else if (type == element::bf16)
+    {
+        return F<bfloat16>::fold(node, args);
+    }
+    else if (type == element::f32)
+    {
+        return F<float>::fold(node, args);
+    }
+    else if (type == element::f64)
+    {
+        return F<double>::fold(node, args);
+    }
+    else if (type == element::i8)
+    {
+        return F<int8_t>::fold(node, args);
+    }
+    else if (type == element::i16)
+    {
+        return F<int16_t>::fold(node, args);
+    }
+    else if (type == element::i32)
+    {
+        return F<int32_t>::fold(node, args);
+    }
+    else if (type == element::i64)
+    {
+        return F<int64_t>::fold(node, args);
+    }
+    else if (type == element::u8)
+    {
+        return F<uint8_t>::fold(node, args);
+    }
+    else if (type == element::u16)
+    {
+        return F<uint16_t>::fold(node, args);
+    }
+    else if (type == element::u32)
+    {
+        return F<uint32_t>::fold(node, args);
+    }
+    else if (type == element::u64)
+    {
+        return F<uint64_t>::fold(node, args);
+    }
+    return nullptr;
+}
+
+template <typename T>
+static shared_ptr<op::Constant> make_constant(const shared_ptr<Node>& node, const vector<T>& data)
+{
+    return make_shared<op::Constant>(node->get_element_type(), node->get_shape(), data.data());
+}
+
+template <typename T>
+struct FoldOp
+{
+    static shared_ptr<op::Constant> fold(const shared_ptr<Node>& node, const ConstantVector& args)
+    {
+        const Shape& out_shape = node->get_shape();
+        vector<T> out(shape_size(out_shape));
+        const T* arg0 = args.at(0)->get_data_ptr<T>();
+        const Shape& arg0_shape = args.at(0)->get_shape();
+        size_t count = out.size();
+
+        // Binary elementwise ops may broadcast their arguments implicitly
+        const T* arg1 = args.size() > 1 ? args.at(1)->get_data_ptr<T>() : nullptr;
+        const Shape& arg1_shape = args.size() > 1 ? args.at(1)->get_shape() : arg0_shape;
+        auto binop = dynamic_pointer_cast<op::util::BinaryElementwise>(node);
+        op::AutoBroadcastType autob = binop ? binop->get_autob() : op::AutoBroadcastType::NONE;
+
+        if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+        {
+            runtime::reference::reshape<T>(
+                arg0, out.data(), arg0_shape, reshape->get_input_order(), out_shape);
+        }
+        else if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(node))
+        {
+            runtime::reference::broadcast<T>(
+                arg0, out.data(), arg0_shape, out_shape, broadcast->get_broadcast_axes());
+        }
+        else if (auto slice = dynamic_pointer_cast<op::Slice>(node))
+        {
+            runtime::reference::slice<T>(arg0,
+                                         out.data(),
+                                         arg0_shape,
+                                         slice->get_lower_bounds(),
+                                         slice->get_upper_bounds(),
+                                         slice->get_strides(),
+                                         out_shape);
+        }
+        else if (auto concat = dynamic_pointer_cast<op::Concat>(node))
+        {
+            vector<const T*> in_args;
+            vector<Shape> in_shapes;
+            for (const shared_ptr<op::Constant>& arg : args)
+            {
+                in_args.push_back(arg->get_data_ptr<T>());
+                in_shapes.push_back(arg->get_shape());
+            }
+            runtime::reference::concat<T>(
+                in_args, out.data(), in_shapes, out_shape, concat->get_concatenation_axis());
+        }
+        else if (auto sum = dynamic_pointer_cast<op::Sum>(node))
+        {
+            runtime::reference::sum<T>(
+                arg0, out.data(), arg0_shape, out_shape, sum->get_reduction_axes());
+        }
+        else if (dynamic_pointer_cast<op::Negative>(node))
+        {
+            runtime::reference::negate<T>(arg0, out.data(), count);
+        }
+        else if (dynamic_pointer_cast<op::Abs>(node))
+        {
+            runtime::reference::abs<T>(arg0, out.data(), count);
+        }
+        else if (dynamic_pointer_cast<op::Sqrt>(node))
+        {
+            runtime::reference::sqrt<T>(arg0, out.data(), count);
+        }
+        else if (dynamic_pointer_cast<op::Add>(node))
+        {
+            runtime::reference::add<T>(arg0, arg1, out.data(), arg0_shape, arg1_shape, autob);
+        }
+        else if (dynamic_pointer_cast<op::Subtract>(node))
+        {
+            runtime::reference::subtract<T>(arg0, arg1, out.data(), arg0_shape, arg1_shape, autob);
+        }
+        else if (dynamic_pointer_cast<op::Multiply>(node))
+        {
+            runtime::reference::multiply<T>(arg0, arg1, out.data(), arg0_shape, arg1_shape, autob);
+        }
+        else if (dynamic_pointer_cast<op::Divide>(node))
+        {
+            runtime::reference::divide<T>(arg0, arg1, out.data(), arg0_shape, arg1_shape, autob);
+        }
+        else if (dynamic_pointer_cast<op::Maximum>(node))
+        {
+            runtime::reference::maximum<T>(arg0, arg1, out.data(), arg0_shape, arg1_shape, autob);
+        }
+        else if (dynamic_pointer_cast<op::Minimum>(node))
+        {
+            runtime::reference::minimum<T>(arg0, arg1, out.data(), arg0_shape, arg1_shape, autob);
+        }
+        else
+        {
+            return nullptr;
+        }
+        return make_constant(node, out);
+    }
+};
+
+struct NoFold
+{
+    static shared_ptr<op::Constant> fold(const shared_ptr<Node>& node, const ConstantVector& args)
+    {
+        return nullptr;
+    }
+};
+
+// Boolean is stored as char and reduced-precision types have no arithmetic kernels, so only
+// Convert folds them
+template <>
+struct FoldOp<char> : NoFold
+{
+};
+
+template <>
+struct FoldOp<float16> : NoFold
+{
+};
+
+template <>
+struct FoldOp<bfloat16> : NoFold
+{
+};
+
+template <typename TI>
+struct FoldConvert
+{
+    template <typename TO>
+    struct To
+    {
+        static shared_ptr<op::Constant> fold(const shared_ptr<Node>& node,
+                                             const ConstantVector& args)
+        {
+            vector<TO> out(shape_size(node->get_shape()));
+            runtime::reference::convert<TI, TO>(
+                args.at(0)->get_data_ptr<TI>(), out.data(), out.size());
+            return make_constant(node, out);
+        }
+    };
+
+    static shared_ptr<op::Constant> fold(const shared_ptr<Node>& node, const ConstantVector& args)
+    {
+        return dispatch<To>(node->get_element_type(), node, args);
+    }
+};
+
+template <typename TO>
+struct FoldQuantize
+{
+    static shared_ptr<op::Constant> fold(const shared_ptr<Node>& node, const ConstantVector& args)
+    {
+        auto quantize = static_pointer_cast<op::Quantize>(node);
+        vector<TO> out(shape_size(node->get_shape()));
+        runtime::reference::quantize<float, TO>(args.at(0)->get_data_ptr<float>(),
+                                                out.data(),
+                                                out.size(),
+                                                quantize->get_scale(),
+                                                quantize->get_zero_point());
+        return make_constant(node, out);
+    }
+};
+
+static shared_ptr<op::Constant> fold(const shared_ptr<Node>& node, const ConstantVector& args)
+{
+    if (dynamic_pointer_cast<op::Convert>(node))
+    {
+        return dispatch<FoldConvert>(args.at(0)->get_element_type(), node, args);
+    }
+    if (dynamic_pointer_cast<op::Quantize>(node))
+    {
+        return dispatch<FoldQuantize>(node->get_element_type(), node, args);
+    }
+    return dispatch<FoldOp>(node->get_element_type(), node, args);
+}
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (shared_ptr<Node> n : f->get_ordered_ops())
+    {
+        if (n->is_constant() || n->is_parameter() || n->is_output() ||
+            n->get_output_size() != 1 || n->get_input_size() == 0)
+        {
+            continue;
+        }
+
+        ConstantVector args;
+        for (const descriptor::Input& input : n->get_inputs())
+        {
+            auto constant = dynamic_pointer_cast<op::Constant>(input.get_output().get_node());
+            if (!constant)
+            {
+                break;
+            }
+            args.push_back(constant);
+        }
+        if (args.size() != n->get_input_size() ||
+            shape_size(n->get_shape()) * n->get_element_type().size() > m_max_folded_bytes)
+        {
+            continue;
+        }
+
+        shared_ptr<op::Constant> folded;
+        try
+        {
+            folded = fold(n, args);
+        }
+        catch (const domain_error&)
+        {
+            // e.g. integer division by zero, leave it to fail at run time
+        }
+        if (folded)
+        {
+            replace_node(n, folded);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ConstantFolding;
+    }
+}
+
+/// \brief Evaluates subgraphs whose inputs are all Constants at compile time.
+///
+/// Reshape, Broadcast, Convert, Quantize, Concat, Slice, Sum and the common elementwise
+/// arithmetic ops are computed with the runtime/reference kernels and replaced by a new
+/// Constant. Folding proceeds in topological order, so whole chains collapse. Results larger
+/// than the size cap are not materialized, which keeps Broadcasts of small constants from
+/// blowing up memory. Dequantize is deliberately not folded so that quantized weights stay
+/// in their narrow storage type.
+class ngraph::pass::ConstantFolding : public ngraph::pass::FunctionPass
+{
+public:
+    /// \param max_folded_bytes Largest Constant the pass may create.
+    ConstantFolding(size_t max_folded_bytes = 16 * 1024 * 1024)
+        : FunctionPass()
+        , m_max_folded_bytes(max_folded_bytes)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    size_t m_max_folded_bytes;
+};
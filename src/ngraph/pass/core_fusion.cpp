@@ -27,14 +27,18 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/log.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -377,3 +381,47 @@ void pass::CoreFusion::construct_optimized_strided_conv()
     auto m = make_shared<pattern::Matcher>(eltwise_conv, callback);
     this->add_matcher(m);
 }
+
+// -sum(labels * log(softmax(x))) over the softmax axes ==> SoftmaxCrossEntropy(x, labels)
+void pass::CoreFusion::construct_softmax_cross_entropy()
+{
+    Shape shape{2, 3};
+    auto logits = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto labels = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto softmax = std::make_shared<op::Softmax>(logits, AxisSet{1});
+    auto softmax_label =
+        std::make_shared<pattern::op::Label>(softmax, nullptr, NodeVector{softmax});
+    auto log = std::make_shared<op::Log>(softmax_label);
+    auto sum = std::make_shared<op::Sum>(labels * log, AxisSet{1});
+    auto sum_label = std::make_shared<pattern::op::Label>(sum, nullptr, NodeVector{sum});
+    auto neg = std::make_shared<op::Negative>(sum_label);
+
+    pattern::graph_rewrite_callback callback = [logits, labels, softmax_label, sum_label](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_softmax_cross_entropy against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        auto m_softmax = std::static_pointer_cast<op::Softmax>(pattern_map[softmax_label]);
+        auto m_sum = std::static_pointer_cast<op::Sum>(pattern_map[sum_label]);
+        if (m_softmax->get_axes() != m_sum->get_reduction_axes())
+        {
+            NGRAPH_DEBUG << "Cross-entropy doesn't reduce over the softmax axes";
+            return false;
+        }
+        if (pattern_map[logits]->get_shape() != pattern_map[labels]->get_shape())
+        {
+            NGRAPH_DEBUG << "Labels are broadcast against the softmax";
+            return false;
+        }
+
+        // The softmax stays if anything else uses it; the loss no longer does
+        auto loss = std::make_shared<op::SoftmaxCrossEntropy>(
+            pattern_map[logits], pattern_map[labels], m_softmax->get_axes());
+        ngraph::replace_node(m.get_match_root(), loss);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(neg, callback);
+    this->add_matcher(m);
+}
@@ -35,8 +35,10 @@ public:
         construct_relu();
         construct_folded_batch_norm();
         construct_optimized_strided_conv();
+        construct_softmax_cross_entropy();
     }
     void construct_relu();
     void construct_folded_batch_norm();
     void construct_optimized_strided_conv();
+    void construct_softmax_cross_entropy();
 };
@@ -14,152 +14,390 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
-#include <set>
+#include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "cse.hpp"
-#include "ngraph/axis_vector.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
-#include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/and.hpp"
 #include "ngraph/op/asin.hpp"
 #include "ngraph/op/atan.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/floor.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/greater.hpp"
+#include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/less.hpp"
+#include "ngraph/op/less_eq.hpp"
 #include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
-#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/not_equal.hpp"
+#include "ngraph/op/one_hot.hpp"
+#include "ngraph/op/or.hpp"
+#include "ngraph/op/pad.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/remainder.hpp"
+#include "ngraph/op/replace_slice.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/reverse.hpp"
+#include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/select.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
 #include "ngraph/op/sinh.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/stop_gradient.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
-#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/util.hpp"
 
 using namespace ngraph;
 
 #define TI(x) std::type_index(typeid(x))
 
-static bool cse_unarywise(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+// The attributes of an op, flattened into a vector of words. Two nodes of the same type with
+// the same inputs, output types and shapes and attribute words compute the same value.
+using Attributes = std::vector<size_t>;
+using AttributeWriter = std::function<void(const Node&, Attributes&)>;
+
+template <typename T>
+static void write_values(Attributes& attrs, const T& values)
+{
+    attrs.push_back(values.size());
+    for (auto v : values)
+    {
+        attrs.push_back(static_cast<size_t>(v));
+    }
+}
+
+static void write_value(Attributes& attrs, double value)
 {
-    NGRAPH_DEBUG << "In cse_unarywise for " << a->get_name() << " and " << b->get_name();
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    attrs.push_back(static_cast<size_t>(bits));
+}
 
-    return a->get_argument(0) == b->get_argument(0);
+static void no_attributes(const Node&, Attributes&)
+{
 }
 
-static bool cse_binarywise(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+static void reduction_attributes(const Node& n, Attributes& attrs)
 {
-    NGRAPH_DEBUG << "In cse_binary for " << a->get_name() << " and " << b->get_name();
+    write_values(attrs, static_cast<const op::util::ArithmeticReduction&>(n).get_reduction_axes());
+}
 
-    return (a->get_argument(0) == b->get_argument(0) && a->get_argument(1) == b->get_argument(1)) ||
-           (a->get_argument(1) == b->get_argument(0) && a->get_argument(0) == b->get_argument(1));
+template <typename T>
+static void slice_attributes(const Node& n, Attributes& attrs)
+{
+    auto& slice = static_cast<const T&>(n);
+    write_values(attrs, slice.get_lower_bounds());
+    write_values(attrs, slice.get_upper_bounds());
+    write_values(attrs, slice.get_strides());
 }
 
-static bool cse_reduction(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+template <typename T>
+static void pool_attributes(const Node& n, Attributes& attrs)
 {
-    NGRAPH_DEBUG << "In cse_reduction for " << a->get_name() << " and " << b->get_name();
+    auto& pool = static_cast<const T&>(n);
+    write_values(attrs, pool.get_window_shape());
+    write_values(attrs, pool.get_window_movement_strides());
+    write_values(attrs, pool.get_padding_below());
+    write_values(attrs, pool.get_padding_above());
+}
 
-    auto ar_a = std::dynamic_pointer_cast<op::util::ArithmeticReduction>(a);
-    auto ar_b = std::dynamic_pointer_cast<op::util::ArithmeticReduction>(b);
+template <typename T>
+static void avg_pool_attributes(const Node& n, Attributes& attrs)
+{
+    pool_attributes<T>(n, attrs);
+    attrs.push_back(static_cast<const T&>(n).get_include_padding_in_avg_computation());
+}
 
-    return ar_a->get_argument(0) == ar_b->get_argument(0) &&
-           ar_a->get_reduction_axes() == ar_b->get_reduction_axes();
+template <typename T>
+static void convolution_backprop_attributes(const Node& n, Attributes& attrs)
+{
+    auto& conv = static_cast<const T&>(n);
+    write_values(attrs, conv.get_window_movement_strides_forward());
+    write_values(attrs, conv.get_window_dilation_strides_forward());
+    write_values(attrs, conv.get_padding_below_forward());
+    write_values(attrs, conv.get_padding_above_forward());
+    write_values(attrs, conv.get_data_dilation_strides_forward());
 }
 
-static std::unordered_map<std::type_index,
-                          std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>
-    initialize_ops_to_cse_handlers()
+// Output element types and shapes are always part of the key, so attributes that only
+// determine them (e.g. Convert's target type or Reshape's output shape) are not repeated here.
+// Ops missing from this table (ops carrying functions, collectives, backend-specific ops)
+// are never merged.
+static std::unordered_map<std::type_index, AttributeWriter> initialize_ops_to_cse_attributes()
 {
-    return std::unordered_map<std::type_index,
-                              std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>({
-        {TI(op::Abs), cse_unarywise},
-        {TI(op::Acos), cse_unarywise},
-        {TI(op::Asin), cse_unarywise},
-        {TI(op::Atan), cse_unarywise},
-        {TI(op::Ceiling), cse_unarywise},
-        {TI(op::Cos), cse_unarywise},
-        {TI(op::Cosh), cse_unarywise},
-        {TI(op::Exp), cse_unarywise},
-        {TI(op::Floor), cse_unarywise},
-        {TI(op::Log), cse_unarywise},
-        {TI(op::Negative), cse_unarywise},
-        {TI(op::Relu), cse_unarywise},
-        {TI(op::Sign), cse_unarywise},
-        {TI(op::Sin), cse_unarywise},
-        {TI(op::Sinh), cse_unarywise},
-        //{TI(op::Softmax), cse_unarywise},
-        {TI(op::Sqrt), cse_unarywise},
-        {TI(op::Tan), cse_unarywise},
-        {TI(op::Tanh), cse_unarywise},
-        {TI(op::Add), cse_binarywise},
-        {TI(op::Divide), cse_binarywise},
-        {TI(op::Maximum), cse_binarywise},
-        {TI(op::Minimum), cse_binarywise},
-        {TI(op::Multiply), cse_binarywise},
-        {TI(op::Power), cse_binarywise},
-        //{TI(op::Remainder), cse_binarywise},
-        {TI(op::Subtract), cse_binarywise},
-        {TI(op::Sum), cse_reduction},
-        {TI(op::Product), cse_reduction},
+    return std::unordered_map<std::type_index, AttributeWriter>({
+        {TI(op::Abs), no_attributes},
+        {TI(op::Acos), no_attributes},
+        {TI(op::Add), no_attributes},
+        {TI(op::And), no_attributes},
+        {TI(op::Asin), no_attributes},
+        {TI(op::Atan), no_attributes},
+        {TI(op::Ceiling), no_attributes},
+        {TI(op::Convert), no_attributes},
+        {TI(op::Cos), no_attributes},
+        {TI(op::Cosh), no_attributes},
+        {TI(op::Divide), no_attributes},
+        {TI(op::Equal), no_attributes},
+        {TI(op::Exp), no_attributes},
+        {TI(op::Floor), no_attributes},
+        {TI(op::Greater), no_attributes},
+        {TI(op::GreaterEq), no_attributes},
+        {TI(op::Less), no_attributes},
+        {TI(op::LessEq), no_attributes},
+        {TI(op::Log), no_attributes},
+        {TI(op::Maximum), no_attributes},
+        {TI(op::Minimum), no_attributes},
+        {TI(op::Multiply), no_attributes},
+        {TI(op::Negative), no_attributes},
+        {TI(op::Not), no_attributes},
+        {TI(op::NotEqual), no_attributes},
+        {TI(op::Or), no_attributes},
+        {TI(op::Power), no_attributes},
+        {TI(op::Relu), no_attributes},
+        {TI(op::ReluBackprop), no_attributes},
+        {TI(op::Remainder), no_attributes},
+        {TI(op::Select), no_attributes},
+        {TI(op::Sign), no_attributes},
+        {TI(op::Sin), no_attributes},
+        {TI(op::Sinh), no_attributes},
+        {TI(op::Sqrt), no_attributes},
+        {TI(op::StopGradient), no_attributes},
+        {TI(op::Subtract), no_attributes},
+        {TI(op::Tan), no_attributes},
+        {TI(op::Tanh), no_attributes},
+        {TI(op::Max), reduction_attributes},
+        {TI(op::Min), reduction_attributes},
+        {TI(op::Product), reduction_attributes},
+        {TI(op::Sum), reduction_attributes},
+        {TI(op::Slice), slice_attributes<op::Slice>},
+        {TI(op::ReplaceSlice), slice_attributes<op::ReplaceSlice>},
+        {TI(op::MaxPool), pool_attributes<op::MaxPool>},
+        {TI(op::MaxPoolBackprop), pool_attributes<op::MaxPoolBackprop>},
+        {TI(op::AvgPool), avg_pool_attributes<op::AvgPool>},
+        {TI(op::AvgPoolBackprop), avg_pool_attributes<op::AvgPoolBackprop>},
+        {TI(op::ConvolutionBackpropData),
+         convolution_backprop_attributes<op::ConvolutionBackpropData>},
+        {TI(op::ConvolutionBackpropFilters),
+         convolution_backprop_attributes<op::ConvolutionBackpropFilters>},
+        {TI(op::Convolution),
+         [](const Node& n, Attributes& attrs) {
+             auto& conv = static_cast<const op::Convolution&>(n);
+             write_values(attrs, conv.get_window_movement_strides());
+             write_values(attrs, conv.get_window_dilation_strides());
+             write_values(attrs, conv.get_padding_below());
+             write_values(attrs, conv.get_padding_above());
+             write_values(attrs, conv.get_data_dilation_strides());
+         }},
+        {TI(op::BatchNorm),
+         [](const Node& n, Attributes& attrs) {
+             auto& bn = static_cast<const op::BatchNorm&>(n);
+             write_value(attrs, bn.get_eps_value());
+             attrs.push_back(bn.get_training_flag());
+         }},
+        {TI(op::BatchNormBackprop),
+         [](const Node& n, Attributes& attrs) {
+             write_value(attrs, static_cast<const op::BatchNormBackprop&>(n).get_eps_value());
+         }},
+        {TI(op::Broadcast),
+         [](const Node& n, Attributes& attrs) {
+             write_values(attrs, static_cast<const op::Broadcast&>(n).get_broadcast_axes());
+         }},
+        {TI(op::Concat),
+         [](const Node& n, Attributes& attrs) {
+             attrs.push_back(static_cast<const op::Concat&>(n).get_concatenation_axis());
+         }},
+        {TI(op::Dequantize),
+         [](const Node& n, Attributes& attrs) {
+             auto& dequantize = static_cast<const op::Dequantize&>(n);
+             write_value(attrs, dequantize.get_scale());
+             attrs.push_back(static_cast<size_t>(dequantize.get_zero_point()));
+         }},
+        {TI(op::Dot),
+         [](const Node& n, Attributes& attrs) {
+             attrs.push_back(static_cast<const op::Dot&>(n).get_reduction_axes_count());
+         }},
+        {TI(op::GetOutputElement),
+         [](const Node& n, Attributes& attrs) {
+             attrs.push_back(static_cast<const op::GetOutputElement&>(n).get_n());
+         }},
+        {TI(op::OneHot),
+         [](const Node& n, Attributes& attrs) {
+             attrs.push_back(static_cast<const op::OneHot&>(n).get_one_hot_axis());
+         }},
+        {TI(op::Pad),
+         [](const Node& n, Attributes& attrs) {
+             auto& pad = static_cast<const op::Pad&>(n);
+             write_values(attrs, pad.get_padding_below());
+             write_values(attrs, pad.get_padding_above());
+             write_values(attrs, pad.get_padding_interior());
+         }},
+        {TI(op::Quantize),
+         [](const Node& n, Attributes& attrs) {
+             auto& quantize = static_cast<const op::Quantize&>(n);
+             write_value(attrs, quantize.get_scale());
+             attrs.push_back(static_cast<size_t>(quantize.get_zero_point()));
+         }},
+        {TI(op::Reshape),
+         [](const Node& n, Attributes& attrs) {
+             write_values(attrs, static_cast<const op::Reshape&>(n).get_input_order());
+         }},
+        {TI(op::Reverse),
+         [](const Node& n, Attributes& attrs) {
+             write_values(attrs, static_cast<const op::Reverse&>(n).get_reversed_axes());
+         }},
+        {TI(op::ReverseSequence),
+         [](const Node& n, Attributes& attrs) {
+             auto& reverse = static_cast<const op::ReverseSequence&>(n);
+             attrs.push_back(reverse.get_batch_axis());
+             attrs.push_back(reverse.get_sequence_axis());
+         }},
+        {TI(op::Softmax),
+         [](const Node& n, Attributes& attrs) {
+             write_values(attrs, static_cast<const op::Softmax&>(n).get_axes());
+         }},
+        {TI(op::SoftmaxCrossEntropy),
+         [](const Node& n, Attributes& attrs) {
+             write_values(attrs, static_cast<const op::SoftmaxCrossEntropy&>(n).get_axes());
+         }},
+        {TI(op::SoftmaxCrossEntropyBackprop),
+         [](const Node& n, Attributes& attrs) {
+             write_values(attrs,
+                          static_cast<const op::SoftmaxCrossEntropyBackprop&>(n).get_axes());
+         }},
     });
 }
 
-static std::unordered_map<std::type_index,
-                          std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>
-    ops_to_cse_handlers = initialize_ops_to_cse_handlers();
+static std::unordered_map<std::type_index, AttributeWriter> ops_to_cse_attributes =
+    initialize_ops_to_cse_attributes();
+
+static size_t hash_bytes(const char* data, size_t size)
+{
+    // FNV-1a
+    size_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static size_t constant_byte_size(const op::Constant& c)
+{
+    return shape_size(c.get_shape()) * c.get_element_type().size();
+}
 
 class NodeKey
 {
 public:
-    NodeKey(std::shared_ptr<Node> n)
+    NodeKey(std::shared_ptr<Node> n, Attributes attributes)
         : m_node(n)
+        , m_attributes(std::move(attributes))
     {
+        for (const descriptor::Input& input : n->get_inputs())
+        {
+            const descriptor::Output& output = input.get_output();
+            m_args.push_back(std::make_pair(output.get_node().get(), output.get_index()));
+        }
+        if (n->is_commutative())
+        {
+            std::sort(m_args.begin(), m_args.end());
+        }
+
+        std::vector<size_t> words{std::hash<std::type_index>{}(TI(*n))};
+        for (auto& arg : m_args)
+        {
+            words.push_back(arg.first->get_instance_id());
+            words.push_back(arg.second);
+        }
+        for (size_t i = 0; i < n->get_output_size(); i++)
+        {
+            words.push_back(n->get_output_element_type(i).hash());
+            words.insert(
+                words.end(), n->get_output_shape(i).begin(), n->get_output_shape(i).end());
+        }
+        words.insert(words.end(), m_attributes.begin(), m_attributes.end());
+        m_hash = hash_combine(words);
     }
 
     std::shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
     bool operator==(const NodeKey& other) const
     {
-        Node& p_this = *m_node.get();
-        Node& p_other = *other.get_node().get();
+        Node& p_this = *m_node;
+        Node& p_other = *other.m_node;
 
-        if (TI(p_this) != TI(p_other))
+        if (m_hash != other.m_hash || TI(p_this) != TI(p_other) || m_args != other.m_args ||
+            m_attributes != other.m_attributes ||
+            p_this.get_output_size() != p_other.get_output_size())
         {
             return false;
         }
-
-        auto eh = ops_to_cse_handlers.find(TI(p_this));
-        if (eh == ops_to_cse_handlers.end())
+        for (size_t i = 0; i < p_this.get_output_size(); i++)
         {
-            return false;
+            if (p_this.get_output_element_type(i) != p_other.get_output_element_type(i) ||
+                p_this.get_output_shape(i) != p_other.get_output_shape(i))
+            {
+                return false;
+            }
         }
-
-        return eh->second(m_node, other.get_node());
+        if (p_this.is_constant())
+        {
+            auto& c_this = static_cast<const op::Constant&>(p_this);
+            auto& c_other = static_cast<const op::Constant&>(p_other);
+            return std::memcmp(c_this.get_data_ptr(),
+                               c_other.get_data_ptr(),
+                               constant_byte_size(c_this)) == 0;
+        }
+        return true;
     }
 
 private:
     std::shared_ptr<Node> m_node;
+    Attributes m_attributes;
+    std::vector<std::pair<Node*, size_t>> m_args;
+    size_t m_hash;
 };
 
 namespace std
@@ -167,35 +405,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        std::size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            std::hash<std::type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            std::vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            auto cargs = k.get_node()->get_arguments();
-
-            //TODO: Do we need another map, so we could
-            //specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                std::sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg->get_instance_id());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        std::size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -207,16 +417,35 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
 
     for (auto n : f->get_ordered_ops())
     {
-        if (n->is_output() || n->is_parameter() ||
-            n->is_constant() /*we could CSE constants as well*/)
+        if (n->is_output() || n->is_parameter())
         {
             continue;
         }
 
-        NodeKey n_key{n};
-        if (expressions.count(n_key))
+        Attributes attributes;
+        if (auto c = std::dynamic_pointer_cast<op::Constant>(n))
+        {
+            // Constants are keyed by their contents; equality re-checks the bytes
+            attributes.push_back(hash_bytes(static_cast<const char*>(c->get_data_ptr()),
+                                            constant_byte_size(*c)));
+        }
+        else
+        {
+            auto writer = ops_to_cse_attributes.find(TI(*n));
+            if (writer == ops_to_cse_attributes.end())
+            {
+                continue;
+            }
+            writer->second(*n, attributes);
+        }
+
+        NodeKey n_key{n, std::move(attributes)};
+        auto it = expressions.find(n_key);
+        if (it != expressions.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
+            NGRAPH_DEBUG << "CSE replacing " << n->get_name() << " with "
+                         << it->second->get_name();
+            ngraph::replace_node(n, it->second);
             replaced = true;
         }
         else
@@ -15,12 +15,67 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+
+#define TI(x) std::type_index(typeid(x))
+
+// Candidate matchers for each op type that roots some pattern, in registration order. Matchers
+// rooted at a pattern op (Label, Any, Skip) can match any node; they are merged into every
+// candidate list and also returned on their own for node types no pattern is rooted at.
+template <typename M>
+class MatcherIndex
+{
+public:
+    MatcherIndex(const std::vector<std::shared_ptr<M>>& matchers)
+    {
+        std::vector<bool> wildcard;
+        for (auto matcher : matchers)
+        {
+            auto root = matcher->get_pattern();
+            bool is_wildcard = std::dynamic_pointer_cast<ngraph::pattern::op::Pattern>(root) !=
+                               nullptr;
+            wildcard.push_back(is_wildcard);
+            if (is_wildcard)
+            {
+                m_wildcards.push_back(matcher);
+            }
+            else
+            {
+                m_index[TI(*root)];
+            }
+        }
+        for (auto& entry : m_index)
+        {
+            for (size_t i = 0; i < matchers.size(); i++)
+            {
+                if (wildcard[i] || TI(*matchers[i]->get_pattern()) == entry.first)
+                {
+                    entry.second.push_back(matchers[i]);
+                }
+            }
+        }
+    }
+
+    const std::vector<std::shared_ptr<M>>& get_candidates(const ngraph::Node& node) const
+    {
+        auto it = m_index.find(TI(node));
+        return it == m_index.end() ? m_wildcards : it->second;
+    }
+
+private:
+    std::unordered_map<std::type_index, std::vector<std::shared_ptr<M>>> m_index;
+    std::vector<std::shared_ptr<M>> m_wildcards;
+};
 
 bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     const std::list<std::shared_ptr<ngraph::Node>>& nodes,
@@ -28,9 +83,10 @@ bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = false;
+    MatcherIndex<pattern::Matcher> index(matchers);
     for (auto node : nodes)
     {
-        for (auto matcher : matchers)
+        for (auto matcher : index.get_candidates(*node))
         {
             NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node << " , "
                          << node->get_name() << " , is_output = " << node->is_output();
@@ -54,32 +110,150 @@ bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Functio
     return run_matchers_on_nodes_list(f->get_ordered_ops(), m_matchers, f);
 }
 
+// Updates live after a rewrite of root, whose users were users, from the neighborhood of the
+// rewrite alone: the nodes the rewrite created are reachable from the new arguments of the
+// users, and the nodes it replaced die once none of their users are live
+static void update_liveness(std::unordered_set<ngraph::Node*>& live,
+                            const std::shared_ptr<ngraph::Node>& root,
+                            const ngraph::NodeVector& users)
+{
+    ngraph::NodeVector created;
+    for (auto user : users)
+    {
+        for (auto arg : user->get_arguments())
+        {
+            if (live.insert(arg.get()).second)
+            {
+                created.push_back(arg);
+            }
+        }
+    }
+    while (!created.empty())
+    {
+        auto node = created.back();
+        created.pop_back();
+        for (auto arg : node->get_arguments())
+        {
+            if (live.insert(arg.get()).second)
+            {
+                created.push_back(arg);
+            }
+        }
+    }
+
+    ngraph::NodeVector candidates{root};
+    while (!candidates.empty())
+    {
+        auto node = candidates.back();
+        candidates.pop_back();
+        if (live.count(node.get()) == 0 || node->is_output() || node->is_parameter())
+        {
+            continue;
+        }
+        bool used = false;
+        for (auto user : node->get_users())
+        {
+            if (live.count(user.get()) != 0)
+            {
+                used = true;
+                break;
+            }
+        }
+        if (!used)
+        {
+            live.erase(node.get());
+            for (auto arg : node->get_arguments())
+            {
+                candidates.push_back(arg);
+            }
+        }
+    }
+}
+
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool changed = false;
-    size_t i = 0;
-    do
+    size_t rewrites = 0;
+    MatcherIndex<pattern::RecurrentMatcher> index(m_matchers);
+
+    std::list<std::shared_ptr<Node>> ops = f->get_ops();
+    std::unordered_set<Node*> live;
+    std::unordered_set<Node*> queued;
+    std::deque<std::shared_ptr<Node>> worklist;
+    for (auto node : ops)
     {
-        for (auto node : f->get_ops())
+        live.insert(node.get());
+        queued.insert(node.get());
+        worklist.push_back(node);
+    }
+
+    while (!worklist.empty() && rewrites < m_num_iters)
+    {
+        auto node = worklist.front();
+        worklist.pop_front();
+        queued.erase(node.get());
+        if (live.count(node.get()) == 0)
         {
-            for (auto matcher : m_matchers)
+            continue;
+        }
+
+        // Snapshot the users so the replacement can be found after the callback rewired them
+        auto users = node->get_users();
+        for (auto matcher : index.get_candidates(*node))
+        {
+            NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node << " , "
+                         << node->get_name() << " , is_output = " << node->is_output();
+            if (matcher->match(node))
             {
-                NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node << " , "
-                             << node->get_name() << " , is_output = " << node->is_output();
-                if (matcher->match(node))
+                NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node << " , "
+                             << node->get_name();
+                if (matcher->process_match())
                 {
-                    NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node << " , "
-                                 << node->get_name();
-                    if (matcher->process_match())
+                    changed = true;
+                    rewrites++;
+
+                    update_liveness(live, node, users);
+
+                    // Revisit the neighborhood of the rewrite: the replacement, the rewired
+                    // users, and the other users of the replaced node's arguments, whose
+                    // matches may depend on how many users those arguments have
+                    std::vector<std::shared_ptr<Node>> revisit;
+                    std::unordered_set<Node*> seen;
+                    auto add_revisit = [&](const std::shared_ptr<Node>& n) {
+                        if (seen.insert(n.get()).second)
+                        {
+                            revisit.push_back(n);
+                        }
+                    };
+                    for (auto user : users)
+                    {
+                        for (auto arg : user->get_arguments())
+                        {
+                            add_revisit(arg);
+                        }
+                    }
+                    for (auto user : users)
+                    {
+                        add_revisit(user);
+                    }
+                    for (auto arg : node->get_arguments())
                     {
-                        changed = true;
-                        goto next_fusion;
+                        for (auto user : arg->get_users())
+                        {
+                            add_revisit(user);
+                        }
                     }
+                    for (auto it = revisit.rbegin(); it != revisit.rend(); ++it)
+                    {
+                        if (live.count(it->get()) != 0 && queued.insert(it->get()).second)
+                        {
+                            worklist.push_front(*it);
+                        }
+                    }
+                    break;
                 }
             }
         }
-    next_fusion:
-        i++;
-    } while (changed && i < m_num_iters);
+    }
     return changed;
 }
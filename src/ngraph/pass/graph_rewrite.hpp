@@ -43,6 +43,8 @@ namespace ngraph
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+/// Matchers are indexed by the op type of their pattern root, so a node is only offered to
+/// matchers whose root has the same type and to matchers rooted at a Label, Any or Skip
 
 class ngraph::pass::GraphRewrite : public FunctionPass
 {
@@ -65,6 +67,11 @@ private:
     std::vector<std::shared_ptr<pattern::Matcher>> m_matchers;
 };
 
+/// \brief RecurrentGraphRewrite applies \sa RecurrentMatcher patterns until no more match
+///
+/// Nodes are processed from a worklist. After a successful rewrite only the replacement and
+/// its transitive users are revisited since a pattern only inspects the arguments of its root.
+/// At most \p num_iters rewrites are applied.
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
 {
 public:
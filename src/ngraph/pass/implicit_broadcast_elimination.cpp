@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/pass/implicit_broadcast_elimination.hpp"
+#include "ngraph/builder/autobroadcast.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool pass::ImplicitBroadcastElimination::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (auto n : f->get_ordered_ops())
+    {
+        auto binop = dynamic_pointer_cast<op::util::BinaryElementwise>(n);
+        if (!binop || !binop->is_implicitly_broadcast())
+        {
+            continue;
+        }
+
+        auto args = builder::numpy_broadcast({n->get_argument(0), n->get_argument(1)});
+        NGRAPH_DEBUG << "Making the broadcast in " << n->get_name() << " explicit";
+        replace_node(n, n->copy_with_new_args(NodeVector{args.first, args.second}));
+        replaced = true;
+    }
+    return replaced;
+}
@@ -15,6 +15,9 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <iomanip>
 #include <iostream>
 #include <memory>
 
@@ -27,6 +30,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -43,6 +47,12 @@ ngraph::pass::Manager::Manager()
     {
         m_serialize = true;
     }
+    static const auto nepp = std::getenv("NGRAPH_ENABLE_PASS_PROFILING");
+    if (nepp)
+    {
+        m_profile = true;
+        m_report = true;
+    }
 }
 
 ngraph::pass::Manager::~Manager()
@@ -53,6 +63,54 @@ void ngraph::pass::Manager::initialize_default_passes()
 {
 }
 
+static size_t count_nodes(const vector<shared_ptr<Function>>& fs)
+{
+    size_t count = 0;
+    for (const shared_ptr<Function>& f : fs)
+    {
+        count += f->get_ops().size();
+    }
+    return count;
+}
+
+static size_t pool_size(const vector<shared_ptr<Function>>& fs)
+{
+    size_t size = 0;
+    for (const shared_ptr<Function>& f : fs)
+    {
+        size += f->get_temporary_pool_size();
+    }
+    return size;
+}
+
+static string demangle(const string& name)
+{
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    string rc = (status == 0 && demangled) ? demangled : name;
+    free(demangled);
+    return rc;
+}
+
+static void print_pass_report(const vector<pass::PassStatistics>& statistics)
+{
+    size_t total = 0;
+    for (const pass::PassStatistics& s : statistics)
+    {
+        total += s.microseconds();
+    }
+    cout << "pass profile (" << total << "us total)\n";
+    cout << setw(10) << "us" << setw(8) << "nodes" << setw(8) << "delta" << setw(12)
+         << "pool bytes"
+         << "  pass\n";
+    for (const pass::PassStatistics& s : statistics)
+    {
+        int64_t delta = static_cast<int64_t>(s.nodes_after()) - s.nodes_before();
+        cout << setw(10) << s.microseconds() << setw(8) << s.nodes_after() << setw(8) << delta
+             << setw(12) << s.pool_size_after() << "  " << demangle(s.name()) << "\n";
+    }
+}
+
 void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
 {
     // find all functions
@@ -61,10 +119,21 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
 
     set<shared_ptr<Function>> tfs(begin(fs), end(fs));
     get_state().set_functions(tfs);
+    get_state().clear_pass_statistics();
 
     size_t index = 0;
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        size_t nodes_before = 0;
+        size_t pool_size_before = 0;
+        stopwatch pass_timer;
+        if (m_profile)
+        {
+            nodes_before = count_nodes(fs);
+            pool_size_before = pool_size(fs);
+            pass_timer.start();
+        }
+
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
         auto function_pass = dynamic_pointer_cast<FunctionPass>(pass);
@@ -99,6 +168,17 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
             }
         }
 
+        if (m_profile)
+        {
+            pass_timer.stop();
+            get_state().add_pass_statistics(PassStatistics(m_pass_names.at(index),
+                                                           pass_timer.get_microseconds(),
+                                                           nodes_before,
+                                                           count_nodes(fs),
+                                                           pool_size_before,
+                                                           pool_size(fs)));
+        }
+
         if (m_visualize || m_serialize)
         {
             //visualizations and serializations will be named after the outermost function
@@ -123,6 +203,11 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
         }
         index++;
     }
+
+    if (m_report)
+    {
+        print_pass_report(get_state().get_pass_statistics());
+    }
 }
 
 ngraph::pass::ManagerState& ngraph::pass::Manager::get_state()
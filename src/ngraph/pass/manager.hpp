@@ -48,10 +48,7 @@ public:
         auto pass = std::make_shared<T>(std::forward<Args>(args)...);
         auto pass_base = std::static_pointer_cast<PassBase>(pass);
         m_pass_list.push_back(pass_base);
-        if (m_visualize || m_serialize)
-        {
-            m_pass_names.push_back(typeid(T).name());
-        }
+        m_pass_names.push_back(typeid(T).name());
     }
 
     void run_passes(std::shared_ptr<Function>);
@@ -59,10 +56,16 @@ public:
     ManagerState& get_state();
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    /// \brief Record wall time, node counts and memory pool size around every pass in
+    ///        ManagerState::get_pass_statistics(). Also enabled by NGRAPH_ENABLE_PASS_PROFILING,
+    ///        which additionally prints a report after each run_passes.
+    void set_pass_profiling(bool new_state) { m_profile = new_state; }
 private:
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     ManagerState m_state;
     bool m_visualize = false;
     bool m_serialize = false;
+    bool m_profile = false;
+    bool m_report = false;
 };
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -26,9 +28,44 @@ namespace ngraph
     namespace pass
     {
         class ManagerState;
+        class PassStatistics;
     }
 }
 
+/// \brief Cost and effect of one pass run, summed over all functions the Manager ran it on.
+class ngraph::pass::PassStatistics
+{
+public:
+    PassStatistics(const std::string& name,
+                   size_t microseconds,
+                   size_t nodes_before,
+                   size_t nodes_after,
+                   size_t pool_size_before,
+                   size_t pool_size_after)
+        : m_name(name)
+        , m_microseconds(microseconds)
+        , m_nodes_before(nodes_before)
+        , m_nodes_after(nodes_after)
+        , m_pool_size_before(pool_size_before)
+        , m_pool_size_after(pool_size_after)
+    {
+    }
+    const std::string& name() const { return m_name; }
+    size_t microseconds() const { return m_microseconds; }
+    size_t nodes_before() const { return m_nodes_before; }
+    size_t nodes_after() const { return m_nodes_after; }
+    /// \return Function::get_temporary_pool_size() before and after the pass.
+    size_t pool_size_before() const { return m_pool_size_before; }
+    size_t pool_size_after() const { return m_pool_size_after; }
+private:
+    std::string m_name;
+    size_t m_microseconds;
+    size_t m_nodes_before;
+    size_t m_nodes_after;
+    size_t m_pool_size_before;
+    size_t m_pool_size_after;
+};
+
 class ngraph::pass::ManagerState
 {
 public:
@@ -41,6 +78,15 @@ public:
         m_function_list.insert(m_function_list.begin(), collection.begin(), collection.end());
     }
 
+    /// \return Per-pass statistics of the last run, in pass order. Only collected when pass
+    ///         profiling is enabled on the Manager.
+    const std::vector<PassStatistics>& get_pass_statistics() const { return m_pass_statistics; }
+    void add_pass_statistics(const PassStatistics& statistics)
+    {
+        m_pass_statistics.push_back(statistics);
+    }
+    void clear_pass_statistics() { m_pass_statistics.clear(); }
 private:
     std::vector<std::shared_ptr<Function>> m_function_list;
+    std::vector<PassStatistics> m_pass_statistics;
 };
@@ -15,10 +15,13 @@
 *******************************************************************************/
 
 #include <exception>
+#include <map>
+#include <set>
 #include <sstream>
 
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/op.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
@@ -38,16 +41,48 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
     MemoryManager mm(m_alignment);
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
+        // Outputs annotated as in place take over the buffer of an input this op is the last
+        // user of. The input must feed only that argument, or the kernel would read an
+        // argument it is overwriting.
+        map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        set<const descriptor::Tensor*> reused_inputs;
+        auto op = dynamic_pointer_cast<ngraph::op::Op>(node);
+        if (op && op->get_op_annotations())
+        {
+            for (auto& oi : op->get_op_annotations()->get_in_place_oi_pairs())
+            {
+                descriptor::Tensor* output = &node->get_output_tensor(oi.output);
+                descriptor::Tensor* input = &node->get_inputs().at(oi.input).get_tensor();
+                size_t uses = 0;
+                for (descriptor::Input& other : node->get_inputs())
+                {
+                    uses += (&other.get_tensor() == input) ? 1 : 0;
+                }
+                if (uses == 1 && node->liveness_free_list.count(input) != 0 &&
+                    node->liveness_new_list.count(output) != 0 &&
+                    input->size() >= output->size() && reused_inputs.count(input) == 0)
+                {
+                    in_place_outputs[output] = input;
+                    reused_inputs.insert(input);
+                }
+            }
+        }
+
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = mm.allocate(tensor->size());
+            auto in_place = in_place_outputs.find(tensor);
+            size_t offset = in_place != in_place_outputs.end() ? in_place->second->get_pool_offset()
+                                                               : mm.allocate(tensor->size());
             tensor->set_pool_offset(offset);
         }
         if (!m_disable_memory_sharing)
         {
             for (const descriptor::Tensor* tensor : node->liveness_free_list)
             {
-                mm.free(tensor->get_pool_offset());
+                if (reused_inputs.count(tensor) == 0)
+                {
+                    mm.free(tensor->get_pool_offset());
+                }
             }
         }
     }
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/pass/mixed_precision.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/get_output_element.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+pass::MixedPrecision::MixedPrecision(const element::Type& type, const set<string>& ops)
+    : m_type(type)
+    , m_ops(ops)
+{
+    if (m_type != element::f16 && m_type != element::bf16)
+    {
+        throw ngraph_error("MixedPrecision only supports f16 and bf16, got " +
+                           m_type.c_type_string());
+    }
+}
+
+const set<string>& pass::MixedPrecision::get_default_ops()
+{
+    static const set<string> ops{"Convolution", "Dot", "MatMulBias", "Lstm"};
+    return ops;
+}
+
+static bool is_f32_only(const shared_ptr<Node>& node)
+{
+    for (const descriptor::Input& input : node->get_inputs())
+    {
+        if (input.get_element_type() != element::f32)
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < node->get_output_size(); i++)
+    {
+        if (node->get_output_element_type(i) != element::f32)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pass::MixedPrecision::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (shared_ptr<Node> n : f->get_ordered_ops())
+    {
+        if (m_ops.count(n->description()) == 0 || !is_f32_only(n))
+        {
+            continue;
+        }
+
+        NodeVector new_args;
+        for (shared_ptr<Node> arg : n->get_arguments())
+        {
+            new_args.push_back(make_shared<op::Convert>(arg, m_type));
+        }
+        shared_ptr<Node> reduced = n->copy_with_new_args(new_args);
+
+        if (n->get_output_size() == 1)
+        {
+            replace_node(n, make_shared<op::Convert>(reduced, element::f32));
+        }
+        else
+        {
+            // Multi-output ops are only consumed through GetOutputElement
+            for (shared_ptr<Node> user : n->get_users())
+            {
+                auto goe = dynamic_pointer_cast<op::GetOutputElement>(user);
+                if (!goe)
+                {
+                    throw ngraph_error("Multi-output op " + n->get_name() +
+                                       " used without GetOutputElement");
+                }
+                auto reduced_goe = make_shared<op::GetOutputElement>(reduced, goe->get_n());
+                replace_node(goe, make_shared<op::Convert>(reduced_goe, element::f32));
+            }
+        }
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MixedPrecision;
+    }
+}
+
+/// \brief Rewrites compute-bound f32 ops to a reduced-precision element type.
+///
+/// Every op whose description is in the rewrite set and whose inputs and outputs are all f32 is
+/// recreated with its inputs converted to the reduced type, and its outputs are converted back
+/// to f32. All other ops, in particular numerically sensitive ones such as Softmax, Sum,
+/// BatchNorm, Log and Exp, are left in f32. Adjacent rewritten ops are separated by a
+/// reduced -> f32 -> reduced Convert pair; run AlgebraicSimplification afterwards to cancel
+/// those so that Converts only remain at precision boundaries.
+class ngraph::pass::MixedPrecision : public ngraph::pass::FunctionPass
+{
+public:
+    /// \param type The reduced-precision element type, f16 or bf16.
+    /// \param ops Descriptions of the ops to rewrite.
+    MixedPrecision(const element::Type& type = element::bf16,
+                   const std::set<std::string>& ops = get_default_ops());
+
+    /// \return Convolution, Dot, MatMulBias and Lstm.
+    static const std::set<std::string>& get_default_ops();
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    element::Type m_type;
+    std::set<std::string> m_ops;
+};
@@ -0,0 +1,303 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <numeric>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/op/util/unary_elementwise.hpp"
+#include "ngraph/pass/reshape_sinking.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// A node of the original graph whose value is now computed as transpose(node, order)
+struct Sunk
+{
+    shared_ptr<Node> node;
+    AxisVector order;
+};
+
+using SunkMap = unordered_map<Node*, Sunk>;
+
+template <typename T>
+static T permute(const T& values, const AxisVector& order)
+{
+    T result(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        result[i] = values.at(order[i]);
+    }
+    return result;
+}
+
+static AxisVector invert(const AxisVector& order)
+{
+    AxisVector inverse(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        inverse[order[i]] = i;
+    }
+    return inverse;
+}
+
+static bool is_identity(const AxisVector& order)
+{
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (order[i] != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool is_transpose(const shared_ptr<op::Reshape>& reshape)
+{
+    auto& input_shape = reshape->get_argument(0)->get_shape();
+    auto& order = reshape->get_input_order();
+    return input_shape.size() == order.size() &&
+           permute(input_shape, order) == reshape->get_output_shape();
+}
+
+static shared_ptr<Node> make_transpose(const shared_ptr<Node>& arg, const AxisVector& order)
+{
+    if (is_identity(order))
+    {
+        return arg;
+    }
+    return make_shared<op::Reshape>(arg, order, permute(arg->get_shape(), order));
+}
+
+// Returns the value of `node` in the original graph, transposing a sunk node back if needed
+static shared_ptr<Node> materialize(const shared_ptr<Node>& node,
+                                    const SunkMap& sunk,
+                                    unordered_map<Node*, shared_ptr<Node>>& materialized)
+{
+    auto it = sunk.find(node.get());
+    if (it == sunk.end())
+    {
+        return node;
+    }
+    auto& value = materialized[node.get()];
+    if (!value)
+    {
+        // A transpose that could not be moved at all is its own materialization
+        auto reshape = dynamic_pointer_cast<op::Reshape>(node);
+        if (reshape && reshape->get_argument(0) == it->second.node &&
+            reshape->get_input_order() == it->second.order)
+        {
+            value = node;
+        }
+        else
+        {
+            value = make_transpose(it->second.node, it->second.order);
+        }
+    }
+    return value;
+}
+
+// Brings an input that was not sunk into the untransposed order, if that is free
+static shared_ptr<Node> untranspose(const shared_ptr<Node>& arg, const AxisVector& order)
+{
+    auto inverse = invert(order);
+    if (arg->is_constant())
+    {
+        // Left for ConstantFolding
+        return make_transpose(arg, inverse);
+    }
+    if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(arg))
+    {
+        auto scalar = broadcast->get_argument(0);
+        if (scalar->get_shape().empty())
+        {
+            return make_shared<op::Broadcast>(scalar,
+                                              permute(broadcast->get_shape(), inverse),
+                                              broadcast->get_broadcast_axes());
+        }
+    }
+    return nullptr;
+}
+
+static bool sink_elementwise(const shared_ptr<Node>& n, SunkMap& sunk)
+{
+    const AxisVector* order = nullptr;
+    for (auto arg : n->get_arguments())
+    {
+        auto it = sunk.find(arg.get());
+        if (it != sunk.end())
+        {
+            if (order && *order != it->second.order)
+            {
+                return false;
+            }
+            order = &it->second.order;
+        }
+    }
+    if (!order)
+    {
+        return false;
+    }
+
+    NodeVector new_args;
+    for (auto arg : n->get_arguments())
+    {
+        auto it = sunk.find(arg.get());
+        auto new_arg = it != sunk.end() ? it->second.node : untranspose(arg, *order);
+        if (!new_arg)
+        {
+            return false;
+        }
+        new_args.push_back(new_arg);
+    }
+    sunk[n.get()] = Sunk{n->copy_with_new_args(new_args), *order};
+    return true;
+}
+
+bool pass::ReshapeSinking::run_on_function(shared_ptr<Function> f)
+{
+    SunkMap sunk;
+    unordered_map<Node*, shared_ptr<Node>> materialized;
+    bool modified = false;
+
+    for (shared_ptr<Node> n : f->get_ordered_ops())
+    {
+        if (n->get_output_size() != 1)
+        {
+            // Multi-output ops only get their inputs materialized
+        }
+        else if (auto reshape = dynamic_pointer_cast<op::Reshape>(n))
+        {
+            if (is_transpose(reshape))
+            {
+                auto arg = reshape->get_argument(0);
+                auto it = sunk.find(arg.get());
+                if (it != sunk.end())
+                {
+                    // Merge with the transpose that was already sunk into arg
+                    sunk[n.get()] = Sunk{it->second.node,
+                                         permute(it->second.order, reshape->get_input_order())};
+                }
+                else
+                {
+                    sunk[n.get()] = Sunk{arg, reshape->get_input_order()};
+                }
+                continue;
+            }
+        }
+        else if (auto softmax = dynamic_pointer_cast<op::Softmax>(n))
+        {
+            auto it = sunk.find(softmax->get_argument(0).get());
+            if (it != sunk.end())
+            {
+                // Axis i of transpose(x, order) is axis order[i] of x
+                AxisSet axes;
+                for (size_t axis : softmax->get_axes())
+                {
+                    axes.insert(it->second.order[axis]);
+                }
+                sunk[n.get()] =
+                    Sunk{make_shared<op::Softmax>(it->second.node, axes), it->second.order};
+                continue;
+            }
+        }
+        else if (dynamic_pointer_cast<op::util::UnaryElementwise>(n) ||
+                 dynamic_pointer_cast<op::util::BinaryElementwise>(n))
+        {
+            // A transpose can't be pushed through an implicitly broadcasting op
+            auto binop = dynamic_pointer_cast<op::util::BinaryElementwise>(n);
+            if (!(binop && binop->is_implicitly_broadcast()) && sink_elementwise(n, sunk))
+            {
+                continue;
+            }
+        }
+        else if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(n))
+        {
+            auto it = sunk.find(broadcast->get_argument(0).get());
+            if (it != sunk.end())
+            {
+                // Broadcast(transpose(x, p)) == transpose(Broadcast'(x), q) where Broadcast'
+                // keeps the broadcast axes in place and lays the axes of x out in order
+                auto& order = it->second.order;
+                auto& axes = broadcast->get_broadcast_axes();
+                Shape out_shape = broadcast->get_shape();
+                vector<size_t> arg_positions;
+                for (size_t i = 0; i < out_shape.size(); i++)
+                {
+                    if (axes.count(i) == 0)
+                    {
+                        arg_positions.push_back(i);
+                    }
+                }
+                AxisVector out_order(out_shape.size());
+                std::iota(out_order.begin(), out_order.end(), 0);
+                Shape new_shape = out_shape;
+                for (size_t j = 0; j < arg_positions.size(); j++)
+                {
+                    out_order[arg_positions[j]] = arg_positions[order[j]];
+                    new_shape[arg_positions[j]] = it->second.node->get_shape()[j];
+                }
+                sunk[n.get()] = Sunk{
+                    make_shared<op::Broadcast>(it->second.node, new_shape, axes), out_order};
+                continue;
+            }
+        }
+        else if (auto slice = dynamic_pointer_cast<op::Slice>(n))
+        {
+            auto it = sunk.find(slice->get_argument(0).get());
+            if (it != sunk.end())
+            {
+                // Slicing commutes with transposition once the bounds are permuted back
+                auto inverse = invert(it->second.order);
+                sunk[n.get()] =
+                    Sunk{make_shared<op::Slice>(it->second.node,
+                                                permute(slice->get_lower_bounds(), inverse),
+                                                permute(slice->get_upper_bounds(), inverse),
+                                                permute(slice->get_strides(), inverse)),
+                         it->second.order};
+                continue;
+            }
+        }
+
+        // n cannot absorb a transpose, so give it back the original values
+        for (descriptor::Input& input : n->get_inputs())
+        {
+            auto arg = input.get_output().get_node();
+            if (sunk.count(arg.get()) != 0)
+            {
+                auto value = materialize(arg, sunk, materialized);
+                if (value != arg)
+                {
+                    NGRAPH_DEBUG << "Materializing " << arg->get_name() << " as "
+                                 << value->get_name() << " for " << n->get_name();
+                    input.replace_output(value, 0);
+                    modified = true;
+                }
+            }
+        }
+    }
+
+    return modified;
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ReshapeSinking;
+    }
+}
+
+/// \brief Pushes transposing Reshapes towards the outputs so that they can cancel.
+///
+/// A transpose is a Reshape whose output shape is a permutation of its input shape. The pass
+/// walks the graph in topological order and carries each transpose through elementwise ops,
+/// Broadcast and Slice by rewriting those ops on the untransposed tensor. Consecutive
+/// transposes are merged and inverse pairs disappear. A single transpose is materialized
+/// again only in front of an op it cannot pass (e.g. Dot, Convolution or a Result), where the
+/// backend may still absorb it (a transposed-operand matmul, a layout conversion).
+///
+/// Binary ops need both inputs in the same order. A Constant or a broadcast scalar on the
+/// other side is permuted to match; any other mismatch materializes the transpose.
+class ngraph::pass::ReshapeSinking : public ngraph::pass::FunctionPass
+{
+public:
+    ReshapeSinking()
+        : FunctionPass()
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
@@ -202,6 +202,7 @@ namespace ngraph
             bool process_match();
 
             std::shared_ptr<Node> get_match_root() { return m_match_root; }
+            std::shared_ptr<Node> get_pattern() { return m_pattern; }
         private:
             std::shared_ptr<Node> m_pattern;
             std::shared_ptr<op::Label> m_recurrent_pattern;
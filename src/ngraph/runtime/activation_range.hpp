@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Observed value range of one f32 output tensor, accumulated over calls.
+        class ActivationRange
+        {
+        public:
+            ActivationRange() = default;
+            ActivationRange(const std::string& name, float min, float max, size_t calls)
+                : m_name(name)
+                , m_min(min)
+                , m_max(max)
+                , m_call_count(calls)
+            {
+            }
+            const std::string& name() const { return m_name; }
+            float min() const { return m_min; }
+            float max() const { return m_max; }
+            size_t call_count() const { return m_call_count; }
+            /// \brief Widen the range to include [min, max] observed in one more call.
+            void update(float min, float max)
+            {
+                m_min = std::min(m_min, min);
+                m_max = std::max(m_max, max);
+                m_call_count++;
+            }
+
+        private:
+            std::string m_name;
+            float m_min = std::numeric_limits<float>::infinity();
+            float m_max = -std::numeric_limits<float>::infinity();
+            size_t m_call_count = 0;
+        };
+    }
+}
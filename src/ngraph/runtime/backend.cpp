@@ -111,6 +111,12 @@ vector<ngraph::runtime::PerformanceCounter>
     return vector<PerformanceCounter>();
 }
 
+vector<ngraph::runtime::ActivationRange>
+    runtime::Backend::get_activation_ranges(shared_ptr<Function> func) const
+{
+    return vector<ActivationRange>();
+}
+
 void runtime::Backend::validate_call(shared_ptr<const Function> function,
                                      const vector<shared_ptr<runtime::TensorView>>& outputs,
                                      const vector<shared_ptr<runtime::TensorView>>& inputs)
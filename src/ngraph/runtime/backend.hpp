@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/activation_range.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -75,6 +76,13 @@ namespace ngraph
             virtual std::vector<PerformanceCounter>
                 get_performance_data(std::shared_ptr<Function> func) const;
 
+            /// @brief Record the min/max of every f32 op output on subsequent calls of func.
+            ///   Used to calibrate quantization parameters; backends without support ignore it.
+            virtual void enable_activation_ranges(std::shared_ptr<Function> func, bool enable) {}
+            /// @brief Ranges recorded since activation ranges were enabled, keyed by node name.
+            virtual std::vector<ActivationRange>
+                get_activation_ranges(std::shared_ptr<Function> func) const;
+
             static bool register_backend(const std::string& name, std::shared_ptr<Backend>);
 
         protected:
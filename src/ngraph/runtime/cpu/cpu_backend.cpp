@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <exception>
+
 #include <tbb/tbb_stddef.h>
 
 #include "ngraph/graph_util.hpp"
@@ -21,6 +24,7 @@
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -30,6 +34,8 @@ extern "C" void create_backend()
 {
     // Force TBB to link to the backend
     tbb::TBB_runtime_interface_version();
+    // Any calibration of the parallel thresholds runs now rather than in the first kernel
+    runtime::cpu::eigen::update_parallel_thresholds();
     runtime::Backend::register_backend("CPU", make_shared<runtime::cpu::CPU_Backend>());
 };
 
@@ -54,12 +60,42 @@ shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor(
 bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
     FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    if (instance.m_external_function == nullptr && instance.m_micro_batches > 1)
+    {
+        size_t batch_size = get_batch_size(func);
+        size_t num_slices = std::min(instance.m_micro_batches, batch_size);
+        for (size_t i = 0; i < num_slices; i++)
+        {
+            // The sizes of the slices differ by at most one entry
+            size_t batch_begin = i * batch_size / num_slices;
+            size_t slice_size = (i + 1) * batch_size / num_slices - batch_begin;
+            auto external_function =
+                make_shared<CPU_ExternalFunction>(slice_batch(func, slice_size));
+            external_function->m_emit_timing = instance.m_performance_counters_enabled;
+            // The slices are the concurrency of the call, and the TaskScheduler would run
+            // their ops off the threads of the slices
+            external_function->m_use_task_scheduler = false;
+            // Primitives shared between the slices would serialize them on their locks
+            external_function->set_mkldnn_cache_scope(i);
+            instance.m_micro_batch_slices.emplace_back(
+                new MicroBatchSlice(external_function->make_call_frame(),
+                                    batch_begin,
+                                    slice_size,
+                                    i,
+                                    num_slices));
+            if (i == 0)
+            {
+                instance.m_external_function = external_function;
+            }
+        }
+    }
+    else if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
         auto cf = instance.m_external_function->make_call_frame();
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        instance.m_call_frame->set_num_threads(instance.m_num_threads);
     }
     return true;
 }
@@ -78,11 +114,53 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
         rc = compile(func);
     }
 
-    instance.m_call_frame->call(outputs, inputs);
+    if (!instance.m_micro_batch_slices.empty())
+    {
+        call_micro_batches(instance, outputs, inputs);
+    }
+    else
+    {
+        instance.m_call_frame->call(outputs, inputs);
+    }
 
     return rc;
 }
 
+void runtime::cpu::CPU_Backend::call_micro_batches(
+    FunctionInstance& instance,
+    const vector<shared_ptr<runtime::TensorView>>& outputs,
+    const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    size_t num_slices = instance.m_micro_batch_slices.size();
+    size_t num_threads = CPUThreadPool::get().get_num_threads();
+    if (instance.m_num_threads != 0)
+    {
+        num_threads = std::min(num_threads, instance.m_num_threads);
+    }
+    num_threads = std::max<size_t>(1, num_threads / num_slices);
+
+    for (auto& slice : instance.m_micro_batch_slices)
+    {
+        slice->start(outputs, inputs, num_threads);
+    }
+    exception_ptr exception;
+    for (auto& slice : instance.m_micro_batch_slices)
+    {
+        try
+        {
+            slice->wait();
+        }
+        catch (...)
+        {
+            exception = current_exception();
+        }
+    }
+    if (exception)
+    {
+        rethrow_exception(exception);
+    }
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
     m_function_map.erase(func);
@@ -98,6 +176,26 @@ void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> fun
     instance.m_performance_counters_enabled = enable;
 }
 
+void runtime::cpu::CPU_Backend::set_num_threads(shared_ptr<Function> func, size_t num_threads)
+{
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_num_threads = num_threads;
+    if (instance.m_call_frame != nullptr)
+    {
+        instance.m_call_frame->set_num_threads(num_threads);
+    }
+}
+
+void runtime::cpu::CPU_Backend::set_micro_batches(shared_ptr<Function> func, size_t num_slices)
+{
+    FunctionInstance& instance = m_function_map[func];
+    if (instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Micro-batches must be set prior to compiling.");
+    }
+    instance.m_micro_batches = std::max<size_t>(1, num_slices);
+}
+
 vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
@@ -18,8 +18,10 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cpu/cpu_micro_batch.hpp"
 
 namespace ngraph
 {
@@ -53,6 +55,16 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
+                /// \brief Limits the calls of func to num_threads threads of the CPU thread
+                ///        pool, or lets them use the whole pool if num_threads is zero.
+                void set_num_threads(std::shared_ptr<Function> func, size_t num_threads);
+                /// \brief Splits the batch axis, axis 0 of the inputs and outputs of func, into
+                ///        num_slices slices of nearly equal size that run concurrently, each in
+                ///        a call frame of its own on a disjoint share of the threads and pinned
+                ///        CPUs of the CPUThreadPool. Must be called before func is compiled, and
+                ///        makes the compilation throw ngraph_error if func is not
+                ///        batch-separable. One slice, the default, runs func as a whole.
+                void set_micro_batches(std::shared_ptr<Function> func, size_t num_slices);
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
 
@@ -63,8 +75,16 @@ namespace ngraph
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    size_t m_num_threads = 0;
+                    size_t m_micro_batches = 1;
+                    std::vector<std::unique_ptr<MicroBatchSlice>> m_micro_batch_slices;
                 };
 
+                void call_micro_batches(
+                    FunctionInstance& instance,
+                    const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
             };
         }
@@ -41,6 +41,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -69,6 +70,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -90,19 +92,29 @@
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/kernel/abs.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/convert.hpp"
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/kernel/multiply.hpp"
+#include "ngraph/runtime/cpu/kernel/quantize.hpp"
+#include "ngraph/runtime/cpu/kernel/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/kernel/result.hpp"
+#include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -163,6 +175,19 @@ using namespace ngraph;
         KV = K<uint64_t>;                                                                          \
     }
 
+// Per-type kernel macro for kernels that only move or convert data and so can also handle the
+// f16/bf16 storage types, which have no arithmetic kernels of their own
+#define SELECT_KERNEL_WITH_REDUCED_PRECISION(KV, ET, K)                                            \
+    if (ET == element::f16)                                                                        \
+    {                                                                                              \
+        KV = K<ngraph::float16>;                                                                   \
+    }                                                                                              \
+    else if (ET == element::bf16)                                                                  \
+    {                                                                                              \
+        KV = K<ngraph::bfloat16>;                                                                  \
+    }                                                                                              \
+    else SELECT_KERNEL(KV, ET, K)
+
 namespace ngraph
 {
     namespace runtime
@@ -235,7 +260,8 @@ namespace ngraph
                 auto& tensor_data = external_function->get_tensor_data();
                 std::function<void(void*, void*, size_t)> kernel;
 
-                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::result);
+                SELECT_KERNEL_WITH_REDUCED_PRECISION(
+                    kernel, out[0].get_element_type(), runtime::cpu::kernel::result);
 
                 auto& arg0_tensor = tensor_data[args[0].get_name()];
                 auto& out0_tensor = tensor_data[out[0].get_name()];
@@ -247,6 +273,50 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Convert)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                std::function<void(void*, void*, size_t)> kernel;
+
+                auto& in_et = args[0].get_element_type();
+                auto& out_et = out[0].get_element_type();
+                if (out_et == element::f32)
+                {
+                    SELECT_KERNEL_WITH_REDUCED_PRECISION(
+                        kernel, in_et, runtime::cpu::kernel::convert_to_float);
+                }
+                else if (out_et == element::f64)
+                {
+                    SELECT_KERNEL_WITH_REDUCED_PRECISION(
+                        kernel, in_et, runtime::cpu::kernel::convert_to_double);
+                }
+                else if (out_et == element::f16)
+                {
+                    SELECT_KERNEL_WITH_REDUCED_PRECISION(
+                        kernel, in_et, runtime::cpu::kernel::convert_to_f16);
+                }
+                else if (out_et == element::bf16)
+                {
+                    SELECT_KERNEL_WITH_REDUCED_PRECISION(
+                        kernel, in_et, runtime::cpu::kernel::convert_to_bf16);
+                }
+                if (!kernel)
+                {
+                    throw ngraph_error("Unsupported Convert in CPU builder");
+                }
+
+                auto element_count = out[0].get_size();
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor, out0_tensor, element_count);
+                };
+                functors.emplace_back(functor);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Constant)
             {
@@ -272,6 +342,279 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::FusedElementwise)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+
+                if (out[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported FusedElementwise in CPU builder");
+                }
+
+                vector<void**> arg_tensors;
+                for (auto& arg : args)
+                {
+                    arg_tensors.push_back(&tensor_data[arg.get_name()]);
+                }
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+                auto loop_shape = fused->get_loop_shape();
+                auto input_strides = fused->get_input_strides();
+                auto program = fused->get_program();
+
+                auto functor = [&, arg_tensors, loop_shape, input_strides, program](
+                    CPURuntimeContext* ctx) {
+                    vector<void*> inputs;
+                    for (auto arg_tensor : arg_tensors)
+                    {
+                        inputs.push_back(*arg_tensor);
+                    }
+                    runtime::cpu::kernel::fused_elementwise<float>(
+                        inputs, out0_tensor, loop_shape, input_strides, program);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Quantize)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                auto quantize = static_cast<const ngraph::op::Quantize*>(node);
+                std::function<void(void*, void*, size_t, float, int64_t)> kernel;
+
+                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::quantize);
+
+                auto element_count = out[0].get_size();
+                auto scale = quantize->get_scale();
+                auto zero_point = quantize->get_zero_point();
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                auto functor = [&, kernel, element_count, scale, zero_point](
+                    CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor, out0_tensor, element_count, scale, zero_point);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dequantize)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                auto dequantize = static_cast<const ngraph::op::Dequantize*>(node);
+                std::function<void(void*, void*, size_t, float, int64_t)> kernel;
+
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::dequantize);
+
+                auto element_count = out[0].get_size();
+                auto scale = dequantize->get_scale();
+                auto zero_point = dequantize->get_zero_point();
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                auto functor = [&, kernel, element_count, scale, zero_point](
+                    CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor, out0_tensor, element_count, scale, zero_point);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedDot)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                auto dot = static_cast<const ngraph::op::QuantizedDot*>(node);
+                std::function<void(void*, void*, void*, size_t, size_t, size_t, float)> kernel;
+
+                SELECT_KERNEL(
+                    kernel, out[0].get_element_type(), runtime::cpu::kernel::quantized_dot);
+
+                auto m = args[0].get_shape().at(0);
+                auto k = args[0].get_shape().at(1);
+                auto n = args[1].get_shape().at(1);
+                auto scale = dot->get_requantization_scale();
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                auto functor = [&, kernel, m, k, n, scale](CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor, arg1_tensor, out0_tensor, m, k, n, scale);
+                };
+                functors.emplace_back(functor);
+            }
+
+            // Builds the MKLDNN primitive of a quantized convolution with or without bias and
+            // binds its arguments and result to their tensors on every call
+            template <typename OP>
+            static void build_quantized_convolution(CPU_ExternalFunction* external_function,
+                                                    const ngraph::Node* node,
+                                                    const std::vector<TensorViewWrapper>& args,
+                                                    const std::vector<TensorViewWrapper>& out)
+            {
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error(node->description() +
+                                       " is only supported with MKLDNN kernel.");
+                }
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+                auto convolution = static_cast<const OP*>(node);
+
+                // For dilation, MKLDNN wants to know how many elements to insert between, not
+                // how far apart to space the elements like nGraph. So we have to subtract 1.
+                Strides window_dilation_strides_adjusted;
+                for (size_t s : convolution->get_window_dilation_strides())
+                {
+                    window_dilation_strides_adjusted.push_back(s - 1);
+                }
+
+                auto input_format = mkldnn_utils::get_input_mkldnn_format(node, 0);
+                auto weights_format = mkldnn_utils::get_input_mkldnn_format(node, 1);
+                // HACK to help MKLDNN pick the right implementation
+                if (weights_format == mkldnn::memory::format::nchw)
+                {
+                    weights_format = mkldnn::memory::format::oihw;
+                }
+                auto output_format = mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_data_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+                auto weights_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                mkldnn::post_ops ops;
+                if (convolution->with_relu())
+                {
+                    ops.append_eltwise(1.f, mkldnn::algorithm::eltwise_relu, 0.f, 0.f);
+                }
+
+                size_t conv_index;
+                if (args.size() == 3)
+                {
+                    auto bias_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[2], mkldnn_utils::get_input_mkldnn_format(node, 2));
+                    conv_index = mkldnn_emitter->build_quantized_convolution_forward(
+                        input_data_desc,
+                        weights_desc,
+                        bias_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides(),
+                        window_dilation_strides_adjusted,
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above(),
+                        convolution->get_requantization_scale(),
+                        ops);
+                }
+                else
+                {
+                    conv_index = mkldnn_emitter->build_quantized_convolution_forward(
+                        input_data_desc,
+                        weights_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides(),
+                        window_dilation_strides_adjusted,
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above(),
+                        convolution->get_requantization_scale(),
+                        ops);
+                }
+
+                // The dependencies are the arguments in order, then the result
+                auto deps = mkldnn_emitter->get_primitive_deps(conv_index);
+                vector<void**> tensors;
+                for (auto& arg : args)
+                {
+                    tensors.push_back(&tensor_data[arg.get_name()]);
+                }
+                tensors.push_back(&tensor_data[out[0].get_name()]);
+
+                auto functor = [&, deps, tensors, conv_index](CPURuntimeContext* ctx) {
+                    for (size_t i = 0; i < tensors.size(); i++)
+                    {
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[i], *tensors[i]);
+                    }
+                    cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedConvolution)
+            {
+                build_quantized_convolution<ngraph::op::QuantizedConvolution>(
+                    external_function, node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedConvolutionBias)
+            {
+                build_quantized_convolution<ngraph::op::QuantizedConvolutionBias>(
+                    external_function, node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::ConvertLayout)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto input_tvl =
+                    node->get_inputs()[0].get_output().get_tensor_view()->get_tensor_view_layout();
+                auto input_cpu_tvl =
+                    dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(input_tvl);
+                auto input_format = input_cpu_tvl->get_mkldnn_format();
+
+                // Reorder input shape if needed
+                auto input_axis_order = input_cpu_tvl->get_axis_order();
+                Shape input_shape(input_axis_order.size());
+                for (size_t idx = 0; idx < input_axis_order.size(); idx++)
+                {
+                    input_shape[idx] = args[0].get_shape()[input_axis_order[idx]];
+                }
+
+                auto output_tvl = node->get_output_tensor_view(0)->get_tensor_view_layout();
+                auto output_format =
+                    dynamic_cast<runtime::cpu::LayoutDescriptor&>(*output_tvl).get_mkldnn_format();
+
+                // MKLDNN relies on format names for selecting optimized kernel implementations
+                if (input_format == mkldnn::memory::format::nchw &&
+                    runtime::cpu::mkldnn_utils::is_mkldnn_filter_format(output_format))
+                {
+                    input_format = mkldnn::memory::format::oihw;
+                }
+                if (output_format == mkldnn::memory::format::nchw &&
+                    runtime::cpu::mkldnn_utils::is_mkldnn_filter_format(input_format))
+                {
+                    output_format = mkldnn::memory::format::oihw;
+                }
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                    input_shape, args[0].get_element_type(), input_format);
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+                size_t reorder_index = mkldnn_emitter->build_reorder(input_desc, result_desc);
+
+                auto deps = mkldnn_emitter->get_primitive_deps(reorder_index);
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                auto functor = [&, deps, reorder_index](CPURuntimeContext* ctx) {
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out0_tensor);
+                    cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, reorder_index);
+                };
+                functors.emplace_back(functor);
+            }
+
 #define TI(x) type_index(typeid(x))
 
             const BuildOpMap build_dispatcher{
@@ -280,7 +623,20 @@ namespace ngraph
                 {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
                 {TI(ngraph::op::Abs), &runtime::cpu::Builder::build<ngraph::op::Abs>},
                 {TI(ngraph::op::Result), &runtime::cpu::Builder::build<ngraph::op::Result>},
-                {TI(ngraph::op::Constant), &runtime::cpu::Builder::build<ngraph::op::Constant>}};
+                {TI(ngraph::op::Convert), &runtime::cpu::Builder::build<ngraph::op::Convert>},
+                {TI(ngraph::op::Constant), &runtime::cpu::Builder::build<ngraph::op::Constant>},
+                {TI(ngraph::op::FusedElementwise),
+                 &runtime::cpu::Builder::build<ngraph::op::FusedElementwise>},
+                {TI(ngraph::op::Quantize), &runtime::cpu::Builder::build<ngraph::op::Quantize>},
+                {TI(ngraph::op::Dequantize), &runtime::cpu::Builder::build<ngraph::op::Dequantize>},
+                {TI(ngraph::op::QuantizedDot),
+                 &runtime::cpu::Builder::build<ngraph::op::QuantizedDot>},
+                {TI(ngraph::op::QuantizedConvolution),
+                 &runtime::cpu::Builder::build<ngraph::op::QuantizedConvolution>},
+                {TI(ngraph::op::QuantizedConvolutionBias),
+                 &runtime::cpu::Builder::build<ngraph::op::QuantizedConvolutionBias>},
+                {TI(ngraph::runtime::cpu::op::ConvertLayout),
+                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>}};
         }
     }
 }
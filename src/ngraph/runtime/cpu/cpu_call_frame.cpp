@@ -20,6 +20,7 @@
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 
 using namespace std;
@@ -29,6 +30,8 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
                                            EntryPoint compiled_function)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_num_threads(0)
+    , m_thread_pool(nullptr)
 {
     setup_runtime_context();
 }
@@ -63,13 +66,22 @@ void runtime::cpu::CPU_CallFrame::call(
     }
 
     // Invoke compiled computation
-    if (!m_external_function->is_direct_execution())
     {
-        m_compiled_function(inputs.data(), outputs.data(), ctx);
-    }
-    else
-    {
-        m_external_function->get_executor()(ctx, inputs, outputs);
+        CPUThreadPool& pool = m_thread_pool ? *m_thread_pool : CPUThreadPool::get();
+        size_t num_threads = pool.get_num_threads();
+        if (m_num_threads != 0)
+        {
+            num_threads = std::min(m_num_threads, num_threads);
+        }
+        CPUThreadPool::ThreadLimit thread_limit(static_cast<int>(num_threads), pool);
+        if (!m_external_function->is_direct_execution())
+        {
+            m_compiled_function(inputs.data(), outputs.data(), ctx);
+        }
+        else
+        {
+            m_external_function->get_executor()(ctx, inputs, outputs);
+        }
     }
 
     if (runtime::cpu::IsTracingEnabled())
@@ -115,17 +127,22 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
     {
         auto buffer = new AlignedBuffer(buffer_size, alignment);
+        CPUThreadPool::get().first_touch(buffer->get_ptr(), buffer_size);
         ctx->memory_buffers.push_back(buffer);
     }
     const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
     ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
     ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
+    ctx->mkldnn_invocations = mkldnn_emitter->get_mkldnn_invocations().data();
+    ctx->mkldnn_bindings = new void*[mkldnn_emitter->get_mkldnn_primitives().size()]();
+    ctx->task_graph = m_external_function->get_task_graph();
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
     delete[] ctx->op_durations;
     delete[] ctx->p_en;
+    delete[] ctx->mkldnn_bindings;
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
@@ -33,6 +33,7 @@ namespace ngraph
         {
             class CPU_CallFrame;
             class CPU_ExternalFunction;
+            class CPUThreadPool;
 
             using EntryPoint_t = void(void** inputs, void** outputs, CPURuntimeContext* ctx);
 
@@ -52,6 +53,15 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
 
+                /// @brief Limits the Eigen kernels, MKLDNN primitives and cblas calls of this
+                /// call frame to num_threads threads of the CPUThreadPool. Zero, the default,
+                /// lets them use the whole pool.
+                void set_num_threads(size_t num_threads) { m_num_threads = num_threads; }
+                size_t get_num_threads() const { return m_num_threads; }
+                /// @brief Runs the Eigen kernels of this call frame on pool instead of the
+                /// CPUThreadPool of the backend, or on the latter again if pool is nullptr.
+                void set_thread_pool(CPUThreadPool* pool) { m_thread_pool = pool; }
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::TensorView>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
@@ -62,6 +72,8 @@ namespace ngraph
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
                 CPURuntimeContext* ctx;
+                size_t m_num_threads;
+                CPUThreadPool* m_thread_pool;
             };
         }
     }
@@ -17,6 +17,8 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <typeindex>
@@ -40,6 +42,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -68,6 +71,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -84,6 +88,7 @@
 #include "ngraph/op/sinh.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -95,12 +100,17 @@
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_epilogue.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias_epilogue.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -132,6 +142,14 @@ static string eigen_matrix_format(const ngraph::Shape& shape, const ngraph::Stri
     return ss.str();
 }
 
+// Prints enough digits that the generated code reproduces value exactly
+static string emit_float_literal(float value)
+{
+    stringstream ss;
+    ss << showpoint << setprecision(numeric_limits<float>::max_digits10) << value << "f";
+    return ss.str();
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -3101,6 +3119,496 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::ConvolutionBiasEpilogue)
+            {
+                auto convolution = static_cast<const ngraph::op::ConvolutionBiasEpilogue*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    // For dilation, MKLDNN wants to know how many elements to insert between, not how far
+                    // apart to space the elements like nGraph. So we have to subtract 1 from each pos.
+                    Strides window_dilation_strides_adjusted;
+                    for (size_t s : convolution->get_window_dilation_strides())
+                    {
+                        window_dilation_strides_adjusted.push_back(s - 1);
+                    }
+
+                    auto input_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                    auto weights_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                    auto bias_format = mkldnn_utils::get_input_mkldnn_format(node, 2);
+                    // HACK to help MKLDNN pick the right implementation
+                    if (weights_format == mkldnn::memory::format::nchw)
+                    {
+                        weights_format = mkldnn::memory::format::oihw;
+                    }
+                    auto output_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+                    auto weights_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                    auto bias_desc = mkldnn_emitter->build_memory_descriptor(args[2], bias_format);
+                    auto result_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                    using PostOpType = ngraph::op::ConvolutionBiasEpilogue::PostOpType;
+                    mkldnn::post_ops ops;
+                    for (auto& post_op : convolution->get_post_ops())
+                    {
+                        mkldnn::algorithm eltwise = mkldnn::algorithm::eltwise_linear;
+                        switch (post_op.type)
+                        {
+                        case PostOpType::Relu: eltwise = mkldnn::algorithm::eltwise_relu; break;
+                        case PostOpType::Tanh: eltwise = mkldnn::algorithm::eltwise_tanh; break;
+                        case PostOpType::Sigmoid:
+                            eltwise = mkldnn::algorithm::eltwise_logistic;
+                            break;
+                        case PostOpType::Abs: eltwise = mkldnn::algorithm::eltwise_abs; break;
+                        case PostOpType::Sqrt: eltwise = mkldnn::algorithm::eltwise_sqrt; break;
+                        case PostOpType::Linear: break;
+                        case PostOpType::Sum: ops.append_sum(post_op.alpha); continue;
+                        }
+                        ops.append_eltwise(1.f, eltwise, post_op.alpha, post_op.beta);
+                    }
+
+                    size_t conv_index = mkldnn_emitter->build_convolution_forward(
+                        input_data_desc,
+                        weights_desc,
+                        bias_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides(),
+                        window_dilation_strides_adjusted,
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above(),
+                        ops);
+
+                    // The sum post-op accumulates into the destination, so that has to hold the
+                    // residual (already in the destination layout) when the primitive runs. It
+                    // usually does, since the output is placed in the residual's buffer.
+                    if (convolution->has_residual())
+                    {
+                        size_t result_size =
+                            mkldnn::memory::primitive_desc(
+                                result_desc, runtime::cpu::mkldnn_utils::global_cpu_engine)
+                                .get_size();
+                        writer << "if (" << out[0].get_name() << " != " << args[3].get_name()
+                               << ")\n";
+                        writer.block_begin();
+                        writer << "memcpy(" << out[0].get_name() << ", " << args[3].get_name()
+                               << ", " << result_size << ");\n";
+                        writer.block_end();
+                    }
+
+                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[0])
+                           << ", " << args[0].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[1])
+                           << ", " << args[1].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[2])
+                           << ", " << args[2].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[3])
+                           << ", " << out[0].get_name() << ");\n";
+
+                    writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
+                           << to_string(conv_index) << ");\n";
+                }
+                else
+                {
+                    throw ngraph_error(
+                        "ConvolutionBiasEpilogue is only supported with MKLDNN kernel.");
+                }
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedConvolution)
+            {
+                auto convolution = static_cast<const ngraph::op::QuantizedConvolution*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    // For dilation, MKLDNN wants to know how many elements to insert between, not how far
+                    // apart to space the elements like nGraph. So we have to subtract 1 from each pos.
+                    Strides window_dilation_strides_adjusted;
+                    for (size_t s : convolution->get_window_dilation_strides())
+                    {
+                        window_dilation_strides_adjusted.push_back(s - 1);
+                    }
+
+                    auto input_format = mkldnn_utils::get_input_mkldnn_format(node, 0);
+                    auto weights_format = mkldnn_utils::get_input_mkldnn_format(node, 1);
+                    // HACK to help MKLDNN pick the right implementation
+                    if (weights_format == mkldnn::memory::format::nchw)
+                    {
+                        weights_format = mkldnn::memory::format::oihw;
+                    }
+                    auto output_format = mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+                    auto weights_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                    auto result_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                    mkldnn::post_ops ops;
+                    if (convolution->with_relu())
+                    {
+                        ops.append_eltwise(1.f, mkldnn::algorithm::eltwise_relu, 0.f, 0.f);
+                    }
+
+                    size_t conv_index = mkldnn_emitter->build_quantized_convolution_forward(
+                        input_data_desc,
+                        weights_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides(),
+                        window_dilation_strides_adjusted,
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above(),
+                        convolution->get_requantization_scale(),
+                        ops);
+
+                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[0])
+                           << ", " << args[0].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[1])
+                           << ", " << args[1].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[2])
+                           << ", " << out[0].get_name() << ");\n";
+
+                    writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
+                           << to_string(conv_index) << ");\n";
+                }
+                else
+                {
+                    throw ngraph_error(
+                        "QuantizedConvolution is only supported with MKLDNN kernel.");
+                }
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedConvolutionBias)
+            {
+                auto convolution = static_cast<const ngraph::op::QuantizedConvolutionBias*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    // For dilation, MKLDNN wants to know how many elements to insert between, not how far
+                    // apart to space the elements like nGraph. So we have to subtract 1 from each pos.
+                    Strides window_dilation_strides_adjusted;
+                    for (size_t s : convolution->get_window_dilation_strides())
+                    {
+                        window_dilation_strides_adjusted.push_back(s - 1);
+                    }
+
+                    auto input_format = mkldnn_utils::get_input_mkldnn_format(node, 0);
+                    auto weights_format = mkldnn_utils::get_input_mkldnn_format(node, 1);
+                    auto bias_format = mkldnn_utils::get_input_mkldnn_format(node, 2);
+                    // HACK to help MKLDNN pick the right implementation
+                    if (weights_format == mkldnn::memory::format::nchw)
+                    {
+                        weights_format = mkldnn::memory::format::oihw;
+                    }
+                    auto output_format = mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+                    auto weights_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                    auto bias_desc = mkldnn_emitter->build_memory_descriptor(args[2], bias_format);
+                    auto result_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                    mkldnn::post_ops ops;
+                    if (convolution->with_relu())
+                    {
+                        ops.append_eltwise(1.f, mkldnn::algorithm::eltwise_relu, 0.f, 0.f);
+                    }
+
+                    size_t conv_index = mkldnn_emitter->build_quantized_convolution_forward(
+                        input_data_desc,
+                        weights_desc,
+                        bias_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides(),
+                        window_dilation_strides_adjusted,
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above(),
+                        convolution->get_requantization_scale(),
+                        ops);
+
+                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[0])
+                           << ", " << args[0].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[1])
+                           << ", " << args[1].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[2])
+                           << ", " << args[2].get_name() << ");\n";
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[3])
+                           << ", " << out[0].get_name() << ");\n";
+
+                    writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
+                           << to_string(conv_index) << ");\n";
+                }
+                else
+                {
+                    throw ngraph_error(
+                        "QuantizedConvolutionBias is only supported with MKLDNN kernel.");
+                }
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedDot)
+            {
+                auto dot = static_cast<const ngraph::op::QuantizedDot*>(node);
+                auto& arg0_shape = args[0].get_shape();
+                auto& arg1_shape = args[1].get_shape();
+
+                writer << "cpu::kernel::quantized_dot<" << out[0].get_type() << ">("
+                       << args[0].get_name() << ",\n";
+                writer << "                           " << args[1].get_name() << ",\n";
+                writer << "                           " << out[0].get_name() << ",\n";
+                writer << "                           " << arg0_shape.at(0) << ",\n";
+                writer << "                           " << arg0_shape.at(1) << ",\n";
+                writer << "                           " << arg1_shape.at(1) << ",\n";
+                writer << "                           "
+                       << emit_float_literal(dot->get_requantization_scale()) << ");\n";
+            }
+
+            static std::string emit_fused_instruction(ngraph::op::FusedElementwise::Opcode opcode,
+                                                      const std::string& x,
+                                                      const std::string& y)
+            {
+                using Opcode = ngraph::op::FusedElementwise::Opcode;
+                switch (opcode)
+                {
+                case Opcode::Abs: return "std::abs(" + x + ")";
+                case Opcode::Exp: return "std::exp(" + x + ")";
+                case Opcode::Log: return "std::log(" + x + ")";
+                case Opcode::Negative: return "-" + x;
+                case Opcode::Relu: return x + " > 0 ? " + x + " : 0";
+                case Opcode::Sigmoid: return "1 / (1 + std::exp(-" + x + "))";
+                case Opcode::Sqrt: return "std::sqrt(" + x + ")";
+                case Opcode::Tanh: return "std::tanh(" + x + ")";
+                case Opcode::Add: return x + " + " + y;
+                case Opcode::Divide: return x + " / " + y;
+                case Opcode::Maximum: return x + " > " + y + " ? " + x + " : " + y;
+                case Opcode::Minimum: return x + " < " + y + " ? " + x + " : " + y;
+                case Opcode::Multiply: return x + " * " + y;
+                case Opcode::Subtract: return x + " - " + y;
+                }
+                throw ngraph_error("Unknown FusedElementwise opcode");
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::FusedElementwise)
+            {
+                auto fused = static_cast<const ngraph::op::FusedElementwise*>(node);
+                auto& loop_shape = fused->get_loop_shape();
+                auto& input_strides = fused->get_input_strides();
+                auto& program = fused->get_program();
+                auto element_type = out[0].get_type();
+
+                // One loop nest over the output; every intermediate is a scalar local, so the
+                // innermost loop is a single vectorizable pass over the inputs
+                auto index = [&](const Strides& strides) {
+                    std::stringstream ss;
+                    bool first = true;
+                    for (size_t d = 0; d < loop_shape.size(); d++)
+                    {
+                        if (strides[d] == 0)
+                        {
+                            continue;
+                        }
+                        ss << (first ? "" : " + ") << "i" << d;
+                        if (strides[d] != 1)
+                        {
+                            ss << " * " << strides[d];
+                        }
+                        first = false;
+                    }
+                    return first ? std::string("0") : ss.str();
+                };
+
+                writer.block_begin();
+                for (size_t d = 0; d < loop_shape.size(); d++)
+                {
+                    if (d == 0)
+                    {
+                        writer << "#pragma omp parallel for\n";
+                    }
+                    writer << "for (size_t i" << d << " = 0; i" << d << " < " << loop_shape[d]
+                           << "; i" << d << "++)\n";
+                    writer.block_begin();
+                }
+
+                std::vector<std::string> values;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    values.push_back(args[i].get_name() + "[" + index(input_strides[i]) + "]");
+                }
+                for (size_t k = 0; k < program.size(); k++)
+                {
+                    auto& instruction = program[k];
+                    std::string x = "(" + values.at(instruction.operands[0]) + ")";
+                    std::string y = instruction.operands.size() > 1
+                                        ? "(" + values.at(instruction.operands[1]) + ")"
+                                        : "";
+                    std::string value = "v" + std::to_string(k);
+                    writer << element_type << " " << value << " = "
+                           << emit_fused_instruction(instruction.opcode, x, y) << ";\n";
+                    values.push_back(value);
+                }
+
+                Strides out_strides(loop_shape.size());
+                size_t stride = 1;
+                for (size_t d = loop_shape.size(); d-- > 0;)
+                {
+                    out_strides[d] = stride;
+                    stride *= loop_shape[d];
+                }
+                writer << out[0].get_name() << "[" << index(out_strides) << "] = " << values.back()
+                       << ";\n";
+
+                for (size_t d = 0; d < loop_shape.size(); d++)
+                {
+                    writer.block_end();
+                }
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::MatmulBiasEpilogue)
+            {
+                auto matmul = static_cast<const ngraph::op::MatmulBiasEpilogue*>(node);
+
+                const Shape& arg0_shape = matmul->get_arg0_shape(); //W
+                const Shape& arg1_shape = matmul->get_arg1_shape(); //x
+                const Shape& out_shape = out[0].get_shape();
+                auto& program = matmul->get_program();
+                auto element_type = out[0].get_type();
+
+                static const char* ctranspose = "cblas::Transpose::Transpose, ";
+                static const char* cnotranspose = "cblas::Transpose::None, ";
+
+                size_t m = out_shape[0];
+                size_t n = out_shape[1];
+                size_t k = matmul->get_is_arg0_transposed() ? arg0_shape[0] : arg0_shape[1];
+                size_t lda = arg0_shape[1];
+                size_t ldb = arg1_shape[1];
+                const char* tranpose_a =
+                    matmul->get_is_arg0_transposed() ? ctranspose : cnotranspose;
+                const char* tranpose_b =
+                    matmul->get_is_arg1_transposed() ? ctranspose : cnotranspose;
+                // Row r0 of the product starts at column r0 of W when W is transposed
+                std::string a_offset =
+                    matmul->get_is_arg0_transposed() ? "r0" : "r0 * " + std::to_string(lda);
+
+                // Blocks of rows small enough to still be in L2 when the epilogue reads them
+                size_t block_elements = 256 * 1024 / out[0].get_element_type().size();
+                size_t block_rows = std::max(1UL, std::min(m, block_elements / std::max(1UL, n)));
+
+                // Index of an operand broadcast along `axes` at row i, column j of the output
+                auto index = [&](const AxisSet& axes) {
+                    if (axes.count(0))
+                    {
+                        return std::string(axes.count(1) ? "0" : "j");
+                    }
+                    return axes.count(1) ? std::string("i") : "i * " + std::to_string(n) + " + j";
+                };
+
+                writer.block_begin();
+                writer << "for (size_t r0 = 0; r0 < " << m << "; r0 += " << block_rows << ")\n";
+                writer.block_begin();
+                writer << "size_t rows = r0 + " << block_rows << " < " << m << " ? " << block_rows
+                       << " : " << m << " - r0;\n";
+                writer << "cblas::cblas_sgemm("
+                       << "cblas::Layout::RowMajor, " << tranpose_a << tranpose_b << "rows, " << n
+                       << ", " << k << ",\n"
+                       << "        1.0f, " << args[0].get_name() << " + " << a_offset << ", "
+                       << max(1UL, lda) << ", " << args[1].get_name() << ", " << max(1UL, ldb)
+                       << ", 0.0f,\n"
+                       << "        " << out[0].get_name() << " + r0 * " << n << ", "
+                       << max(1UL, n) << ");\n";
+
+                writer << "#pragma omp parallel for\n";
+                writer << "for (size_t i = r0; i < r0 + rows; i++)\n";
+                writer.block_begin();
+                writer << "for (size_t j = 0; j < " << n << "; j++)\n";
+                writer.block_begin();
+
+                std::vector<std::string> values;
+                std::string product = out[0].get_name() + "[i * " + std::to_string(n) + " + j]";
+                if (matmul->has_bias())
+                {
+                    // The bias is broadcast along its axes, so it is indexed by the others
+                    writer << element_type << " acc = " << product << " + "
+                           << args[2].get_name() << "[" << index(matmul->get_broadcast_axes())
+                           << "];\n";
+                    values.push_back("acc");
+                }
+                else
+                {
+                    values.push_back(product);
+                }
+                auto& input_broadcast_axes = matmul->get_input_broadcast_axes();
+                for (size_t i = 0; i < input_broadcast_axes.size(); i++)
+                {
+                    values.push_back(args[matmul->get_first_input() + i].get_name() + "[" +
+                                     index(input_broadcast_axes[i]) + "]");
+                }
+                for (size_t p = 0; p < program.size(); p++)
+                {
+                    auto& instruction = program[p];
+                    std::string x = "(" + values.at(instruction.operands[0]) + ")";
+                    std::string y = instruction.operands.size() > 1
+                                        ? "(" + values.at(instruction.operands[1]) + ")"
+                                        : "";
+                    std::string value = "v" + std::to_string(p);
+                    writer << element_type << " " << value << " = "
+                           << emit_fused_instruction(instruction.opcode, x, y) << ";\n";
+                    values.push_back(value);
+                }
+                writer << product << " = " << values.back() << ";\n";
+
+                writer.block_end();
+                writer.block_end();
+                writer.block_end();
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Quantize)
+            {
+                auto quantize = static_cast<const ngraph::op::Quantize*>(node);
+                writer << "reference::quantize<" << args[0].get_type() << ", "
+                       << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
+                writer << "                     " << out[0].get_name() << ",\n";
+                writer << "                     " << out[0].get_size() << ",\n";
+                writer << "                     " << emit_float_literal(quantize->get_scale())
+                       << ",\n";
+                writer << "                     " << quantize->get_zero_point() << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Dequantize)
+            {
+                auto dequantize = static_cast<const ngraph::op::Dequantize*>(node);
+                writer << "reference::dequantize<" << args[0].get_type() << ", "
+                       << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
+                writer << "                       " << out[0].get_name() << ",\n";
+                writer << "                       " << out[0].get_size() << ",\n";
+                writer << "                       "
+                       << emit_float_literal(dequantize->get_scale()) << ",\n";
+                writer << "                       " << dequantize->get_zero_point() << ");\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ConvolutionBiasBackpropFiltersBias)
             {
@@ -4452,6 +4960,86 @@ namespace ngraph
                 writer.block_end();
             }
 
+            // Splits shape into [rows, cols] when axes are its trailing axes, which is how a
+            // classifier's logits are laid out
+            static bool get_softmax_rows(const Shape& shape,
+                                         const AxisSet& axes,
+                                         size_t& rows,
+                                         size_t& cols)
+            {
+                size_t first_axis = shape.size() - axes.size();
+                rows = 1;
+                cols = 1;
+                for (size_t d = 0; d < shape.size(); d++)
+                {
+                    if (d < first_axis && axes.count(d) != 0)
+                    {
+                        return false;
+                    }
+                    (d < first_axis ? rows : cols) *= shape[d];
+                }
+                return rows * cols != 0;
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::SoftmaxCrossEntropy)
+            {
+                auto softmax_cross_entropy =
+                    static_cast<const ngraph::op::SoftmaxCrossEntropy*>(node);
+                auto& shape = args[0].get_shape();
+                auto& axes = softmax_cross_entropy->get_axes();
+                size_t rows, cols;
+                if (get_softmax_rows(shape, axes, rows, cols))
+                {
+                    writer << "cpu::kernel::softmax_cross_entropy<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                                   " << args[1].get_name()
+                           << ",\n";
+                    writer << "                                   " << out[0].get_name() << ",\n";
+                    writer << "                                   " << rows << ",\n";
+                    writer << "                                   " << cols << ");\n";
+                }
+                else
+                {
+                    writer << "reference::softmax_cross_entropy<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                                   " << args[1].get_name()
+                           << ",\n";
+                    writer << "                                   " << out[0].get_name() << ",\n";
+                    writer << "                                   {" << join(shape) << "},\n";
+                    writer << "                                   {" << join(axes) << "});\n";
+                }
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::SoftmaxCrossEntropyBackprop)
+            {
+                auto backprop = static_cast<const ngraph::op::SoftmaxCrossEntropyBackprop*>(node);
+                auto& shape = args[0].get_shape();
+                auto& axes = backprop->get_axes();
+                size_t rows, cols;
+                if (get_softmax_rows(shape, axes, rows, cols))
+                {
+                    writer << "cpu::kernel::softmax_cross_entropy_backprop<" << out[0].get_type()
+                           << ">(" << args[0].get_name() << ",\n";
+                    writer << "    " << args[1].get_name() << ",\n";
+                    writer << "    " << args[2].get_name() << ",\n";
+                    writer << "    " << out[0].get_name() << ",\n";
+                    writer << "    " << rows << ",\n";
+                    writer << "    " << cols << ");\n";
+                }
+                else
+                {
+                    writer << "reference::softmax_cross_entropy_backprop<" << out[0].get_type()
+                           << ">(" << args[0].get_name() << ",\n";
+                    writer << "    " << args[1].get_name() << ",\n";
+                    writer << "    " << args[2].get_name() << ",\n";
+                    writer << "    " << out[0].get_name() << ",\n";
+                    writer << "    {" << join(shape) << "},\n";
+                    writer << "    {" << join(axes) << "});\n";
+                }
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Result)
             {
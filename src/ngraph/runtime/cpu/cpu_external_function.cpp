@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -50,6 +51,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -78,6 +80,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -94,20 +97,25 @@
 #include "ngraph/op/sinh.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/broadcast_absorption.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
+#include "ngraph/pass/implicit_broadcast_elimination.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/reshape_sinking.hpp"
 #include "ngraph/pass/result_copy_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
@@ -116,26 +124,36 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_epilogue.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias_epilogue.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_epilogue_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quantization_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_reduced_precision_lowering.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_shuffle_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
@@ -212,6 +230,8 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::AllReduce), &runtime::cpu::CPU_Emitter::emit<op::AllReduce>},
 #endif
     {TI(ngraph::op::MatmulBias), &runtime::cpu::CPU_Emitter::emit<op::MatmulBias>},
+    {TI(ngraph::op::MatmulBiasEpilogue),
+     &runtime::cpu::CPU_Emitter::emit<op::MatmulBiasEpilogue>},
     {TI(ngraph::op::Dot), &runtime::cpu::CPU_Emitter::emit<op::Dot>},
     {TI(ngraph::op::Multiply), &runtime::cpu::CPU_Emitter::emit<op::Multiply>},
     {TI(ngraph::op::Parameter), &runtime::cpu::CPU_Emitter::nop},
@@ -267,6 +287,15 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::ConvolutionRelu), &runtime::cpu::CPU_Emitter::emit<op::ConvolutionRelu>},
     {TI(ngraph::op::ConvolutionBiasRelu),
      &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBiasRelu>},
+    {TI(ngraph::op::ConvolutionBiasEpilogue),
+     &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBiasEpilogue>},
+    {TI(ngraph::op::QuantizedConvolution),
+     &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolution>},
+    {TI(ngraph::op::QuantizedConvolutionBias),
+     &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolutionBias>},
+    {TI(ngraph::op::QuantizedDot), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDot>},
+    {TI(ngraph::op::Quantize), &runtime::cpu::CPU_Emitter::emit<op::Quantize>},
+    {TI(ngraph::op::Dequantize), &runtime::cpu::CPU_Emitter::emit<op::Dequantize>},
     // conv+bias backprop for data share the same implementation as ConvolutionBackpropData
     {TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
      &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBiasBackpropFiltersBias>},
@@ -298,9 +327,14 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Rnn), &runtime::cpu::CPU_Emitter::emit<op::Rnn>},
     {TI(ngraph::op::Sigmoid), &runtime::cpu::CPU_Emitter::emit<op::Sigmoid>},
     {TI(ngraph::op::SigmoidMultiply), &runtime::cpu::CPU_Emitter::emit<op::SigmoidMultiply>},
+    {TI(ngraph::op::FusedElementwise), &runtime::cpu::CPU_Emitter::emit<op::FusedElementwise>},
     {TI(ngraph::op::SigmoidMultiplyBackprop),
      &runtime::cpu::CPU_Emitter::emit<op::SigmoidMultiplyBackprop>},
     {TI(ngraph::op::Softmax), &runtime::cpu::CPU_Emitter::emit<op::Softmax>},
+    {TI(ngraph::op::SoftmaxCrossEntropy),
+     &runtime::cpu::CPU_Emitter::emit<op::SoftmaxCrossEntropy>},
+    {TI(ngraph::op::SoftmaxCrossEntropyBackprop),
+     &runtime::cpu::CPU_Emitter::emit<op::SoftmaxCrossEntropyBackprop>},
     {TI(ngraph::op::SigmoidBackprop), &runtime::cpu::CPU_Emitter::emit<op::SigmoidBackprop>},
     {TI(ngraph::op::And), &runtime::cpu::CPU_Emitter::emit<op::And>},
     {TI(ngraph::op::Or), &runtime::cpu::CPU_Emitter::emit<op::Or>},
@@ -317,6 +351,8 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_compiled_function(nullptr)
     , m_emit_timing(false)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_use_task_scheduler(TaskScheduler::get_inter_op_parallelism() > 1)
+    , m_mkldnn_cache_scope(0)
     , m_function_name(function->get_name())
     , m_is_built(false)
     , m_direct_execution(std::getenv("NGRAPH_DEX") != nullptr)
@@ -334,7 +370,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
         return;
     }
 
-    m_mkldnn_emitter.reset(new MKLDNNEmitter());
+    m_mkldnn_emitter.reset(new MKLDNNEmitter(m_mkldnn_cache_scope));
 
     ngraph::pass::Manager pass_manager;
 
@@ -342,17 +378,28 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     //in which case they should run this pass(CPUWorkspaceInsertion) explicitly
     NodeVector nv_cwi;
     pass_manager.register_pass<ngraph::pass::NopElimination>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUReducedPrecisionLowering>();
     pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
     pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
+    pass_manager.register_pass<ngraph::pass::ReshapeSinking>();
     pass_manager.register_pass<runtime::cpu::pass::MultiLayerRNNFusion>();
     pass_manager.register_pass<runtime::cpu::pass::ConcatInputs>();
     pass_manager.register_pass<runtime::cpu::pass::CPUBatchFusion>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUQuantizationFusion>();
+    pass_manager.register_pass<ngraph::pass::BroadcastAbsorption>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    // Computes the weights CPUEpilogueFusion folded scale factors into
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
+    pass_manager.register_pass<ngraph::pass::ImplicitBroadcastElimination>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
+    // After CPUAssignment so that ops given to MKLDNN stay out of the fused loops
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPUPostLayoutOptimizations>();
     pass_manager.register_pass<runtime::cpu::pass::CPUShuffleFolding>();
@@ -378,6 +425,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/cpu/cpu_eigen_utils.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/kernel/quantized_dot.hpp"
+#include "ngraph/runtime/cpu/kernel/softmax_cross_entropy.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
@@ -385,6 +434,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
@@ -394,6 +444,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/or.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -404,9 +455,12 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
 #include "ngraph/runtime/reference/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/softmax_cross_entropy.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph::runtime::cpu::eigen;
@@ -423,6 +477,13 @@ using namespace ngraph::runtime;
         writer << "#include <tbb/flow_graph.h>\n";
     }
 
+    if (m_use_task_scheduler)
+    {
+        writer << "#include \"ngraph/runtime/cpu/cpu_task_scheduler.hpp\"\n";
+        writer << "extern \"C\" int omp_get_max_threads();\n";
+        writer << "extern \"C\" void omp_set_num_threads(int);\n";
+    }
+
     string pch_header_source = writer.get_code();
 
     // The "dso_handle" symbol is required by __cxa_atexit()
@@ -498,7 +559,7 @@ using namespace ngraph::runtime;
                 shared_ptr<descriptor::TensorView> tv = node->get_outputs()[0].get_tensor_view();
                 string type = tv->get_tensor().get_element_type().c_type_string();
                 writer << "static " << type << "* " << tv->get_tensor().get_name() << " = (("
-                       << type << "*)(" << c->get_data_ptr() << "));\n";
+                       << type << "*)(" << place_constant(c) << "));\n";
                 m_variable_name_map[tv->get_tensor().get_name()] = tv->get_tensor().get_name();
             }
         }
@@ -629,6 +690,23 @@ using namespace ngraph::runtime;
             }
         }
 
+        // The ops of the main function run on the TaskScheduler when it has independent
+        // branches. Tracing and the TBB flow graph keep the sequential schedule.
+        unordered_map<const Node*, size_t> task_indices;
+        bool use_task_scheduler = false;
+        if (m_use_task_scheduler && !m_use_tbb && !runtime::cpu::IsTracingEnabled() &&
+            current_function->get_name() == m_function_name)
+        {
+            auto task_graph = build_task_graph(ordered_ops, task_indices);
+            if (task_graph->has_concurrency())
+            {
+                m_task_graph = move(task_graph);
+                use_task_scheduler = true;
+                // Start the pool now rather than on the first call
+                TaskScheduler::get();
+            }
+        }
+
         writer << "bool " << current_function->get_name() << "_t_en[" << tensor_index << "];\n";
         writer << "bool " << current_function->get_name() << "_init = true;\n";
 
@@ -709,6 +787,18 @@ using namespace ngraph::runtime;
             }
         }
 
+        if (use_task_scheduler)
+        {
+            // Each op becomes a case of run_task, which the TaskScheduler calls with the
+            // number of intra-op threads the op may use
+            writer << "int num_threads = omp_get_max_threads();\n";
+            writer << "auto run_task = [&](size_t task, int task_threads) {\n";
+            writer.indent++;
+            writer << "omp_set_num_threads(task_threads);\n";
+            writer << "switch (task)\n";
+            writer << "{\n";
+        }
+
         for (shared_ptr<Node> node : ordered_ops)
         {
             auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
@@ -754,6 +844,12 @@ using namespace ngraph::runtime;
                            << "(G, [&](const tbb::flow::continue_msg &msg)\n{\n";
                     writer.indent++;
                 }
+                if (use_task_scheduler)
+                {
+                    writer << "case " << task_indices.at(node.get()) << ":\n";
+                    writer << "{\n";
+                    writer.indent++;
+                }
                 if (runtime::cpu::IsTracingEnabled() &&
                     current_function->get_name() == m_function_name)
                 {
@@ -898,9 +994,37 @@ using namespace ngraph::runtime;
                     writer.indent--;
                     writer << "});\n";
                 }
+                if (use_task_scheduler)
+                {
+                    writer << "break;\n";
+                    writer.indent--;
+                    writer << "}\n";
+                }
             }
         }
 
+        if (use_task_scheduler)
+        {
+            writer << "}\n";
+            writer.indent--;
+            writer << "};\n";
+            writer << "try\n";
+            writer << "{\n";
+            writer.indent++;
+            writer << "cpu::TaskScheduler::get().execute(*ctx->task_graph, run_task, "
+                      "num_threads);\n";
+            writer.indent--;
+            writer << "}\n";
+            writer << "catch (...)\n";
+            writer << "{\n";
+            writer.indent++;
+            writer << "omp_set_num_threads(num_threads);\n";
+            writer << "throw;\n";
+            writer.indent--;
+            writer << "}\n";
+            writer << "omp_set_num_threads(num_threads);\n";
+        }
+
         if (m_use_tbb)
         {
             writer << "\n";
@@ -1026,7 +1150,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         return;
     }
 
-    m_mkldnn_emitter.reset(new MKLDNNEmitter());
+    m_mkldnn_emitter.reset(new MKLDNNEmitter(m_mkldnn_cache_scope));
 
     ngraph::pass::Manager pass_manager;
 
@@ -1034,15 +1158,26 @@ void runtime::cpu::CPU_ExternalFunction::build()
     //in which case they should run this pass(CPUWorkspaceInsertion) explicitly
     NodeVector nv_cwi;
     pass_manager.register_pass<ngraph::pass::NopElimination>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUReducedPrecisionLowering>();
     pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
     pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
     pass_manager.register_pass<runtime::cpu::pass::ConcatInputs>();
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
+    pass_manager.register_pass<ngraph::pass::ReshapeSinking>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUQuantizationFusion>();
+    pass_manager.register_pass<ngraph::pass::BroadcastAbsorption>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    // Computes the weights CPUEpilogueFusion folded scale factors into
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
+    pass_manager.register_pass<ngraph::pass::ImplicitBroadcastElimination>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
+    // After CPUAssignment so that ops given to MKLDNN stay out of the fused loops
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPUPostLayoutOptimizations>();
     pass_manager.register_pass<runtime::cpu::pass::CPUShuffleFolding>();
@@ -1138,7 +1273,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         if (c)
         {
             auto tv = node->get_outputs()[0].get_tensor_view();
-            tensor_data[tv->get_tensor().get_name()] = const_cast<void*>(c->get_data_ptr());
+            tensor_data[tv->get_tensor().get_name()] = const_cast<void*>(place_constant(c));
         }
     }
 
@@ -1356,3 +1491,91 @@ string runtime::cpu::CPU_ExternalFunction::strip_comments(const string& s)
     }
     return out.str();
 }
+
+// While the threads of the CPUThreadPool are pinned, constants are copied into buffers the
+// pool first touches, so kernels read them from the local NUMA node
+const void*
+    runtime::cpu::CPU_ExternalFunction::place_constant(const ngraph::op::Constant* constant)
+{
+    auto& pool = CPUThreadPool::get();
+    size_t size = shape_size(constant->get_shape()) * constant->get_element_type().size();
+    if (pool.get_affinity().empty() || size == 0)
+    {
+        return constant->get_data_ptr();
+    }
+    // The alignment of CPUTensorView buffers
+    m_constant_buffers.emplace_back(new AlignedBuffer(size, 64));
+    void* data = m_constant_buffers.back()->get_ptr();
+    pool.first_touch(data, size);
+    memcpy(data, constant->get_data_ptr(), size);
+    return data;
+}
+
+// Tasks are the ops other than parameters and constants, numbered in execution order. The
+// cost of a task is the size of the tensors it reads and writes.
+unique_ptr<runtime::cpu::TaskGraph> runtime::cpu::CPU_ExternalFunction::build_task_graph(
+    const list<shared_ptr<Node>>& ordered_ops, unordered_map<const Node*, size_t>& task_indices)
+{
+    for (shared_ptr<Node> node : ordered_ops)
+    {
+        if (!node->is_parameter() && !node->is_constant())
+        {
+            size_t task = task_indices.size();
+            task_indices.insert({node.get(), task});
+        }
+    }
+
+    unique_ptr<TaskGraph> graph(new TaskGraph(task_indices.size()));
+    for (shared_ptr<Node> node : ordered_ops)
+    {
+        auto it = task_indices.find(node.get());
+        if (it == task_indices.end())
+        {
+            continue;
+        }
+        size_t task = it->second;
+
+        double cost = 0;
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            cost += input.get_tensor().size();
+            auto producer = task_indices.find(input.get_output().get_node().get());
+            if (producer != task_indices.end())
+            {
+                graph->add_dependency(producer->second, task);
+            }
+        }
+        for (const descriptor::Output& output : node->get_outputs())
+        {
+            cost += output.get_tensor().size();
+        }
+        graph->set_cost(task, cost);
+
+        // An output computed in place overwrites its input, so the other readers of the
+        // input have to finish first
+        auto op = dynamic_pointer_cast<ngraph::op::Op>(node);
+        if (op && op->get_op_annotations())
+        {
+            for (auto& oi : op->get_op_annotations()->get_in_place_oi_pairs())
+            {
+                const descriptor::Input& input = node->get_inputs().at(oi.input);
+                if (task_indices.count(input.get_output().get_node().get()) == 0 ||
+                    input.get_tensor().get_pool_offset() !=
+                        node->get_output_tensor(oi.output).get_pool_offset())
+                {
+                    continue;
+                }
+                for (const descriptor::Input* reader : input.get_output().get_inputs())
+                {
+                    auto other = task_indices.find(reader->get_node().get());
+                    if (other != task_indices.end() && other->second < task)
+                    {
+                        graph->add_dependency(other->second, task);
+                    }
+                }
+            }
+        }
+    }
+    graph->finalize();
+    return graph;
+}
@@ -30,8 +30,11 @@
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_task_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 
@@ -85,6 +88,9 @@ namespace ngraph
                     return m_memory_buffer_sizes;
                 }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
+                /// \brief The ops of the compiled function as scheduled by the TaskScheduler,
+                ///        or nullptr if they run in sequential order.
+                const TaskGraph* get_task_graph() const { return m_task_graph.get(); }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
                     return m_mkldnn_emitter;
@@ -106,6 +112,11 @@ namespace ngraph
                     return executor;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                /// \brief Shares MKLDNN primitives only with external functions of the same
+                ///        scope. Functions that run concurrently on the same shapes need
+                ///        distinct scopes, or they take turns on the locks of the shared
+                ///        primitives. Must be set before the call frame is made.
+                void set_mkldnn_cache_scope(size_t scope) { m_mkldnn_cache_scope = scope; }
             protected:
                 void build();
                 void compile();
@@ -129,7 +140,11 @@ namespace ngraph
                     const Node&,
                     const std::unordered_map<const Node*, std::string>& node_cache);
                 std::string emit_op_as_function(const Node&, const std::string& function_name);
+                std::unique_ptr<TaskGraph>
+                    build_task_graph(const std::list<std::shared_ptr<Node>>& ordered_ops,
+                                     std::unordered_map<const Node*, size_t>& task_indices);
                 std::string strip_comments(const std::string&);
+                const void* place_constant(const ngraph::op::Constant* constant);
                 void release_function() { m_function = nullptr; }
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_release_function;
@@ -139,6 +154,9 @@ namespace ngraph
                 std::unique_ptr<codegen::ExecutionEngine> m_execution_engine;
                 bool m_emit_timing;
                 bool m_use_tbb;
+                bool m_use_task_scheduler;
+                size_t m_mkldnn_cache_scope;
+                std::unique_ptr<TaskGraph> m_task_graph;
 
                 std::unordered_map<std::string, std::string> m_variable_name_map;
                 std::map<std::string, size_t> m_name_index_map;
@@ -147,6 +165,8 @@ namespace ngraph
                 // Constant ops we need to keep a list of shared_ptr to each Constant
                 // so they don't get freed before we are done with them
                 std::vector<std::shared_ptr<Node>> m_active_constants;
+                // Copies of the constants placed on the NUMA node of the CPUThreadPool
+                std::vector<std::unique_ptr<AlignedBuffer>> m_constant_buffers;
 
                 LayoutDescriptorPtrs parameter_layout_descriptors;
                 LayoutDescriptorPtrs result_layout_descriptors;
@@ -0,0 +1,363 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/pad.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/op/util/unary_elementwise.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_micro_batch.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Clones node, a user of the batch axis, for a slice of the batch, or returns nullptr if it
+// mixes the entries of the batch. batched[i] tells whether argument i carries the batch axis.
+static shared_ptr<Node> slice_node(const shared_ptr<Node>& node,
+                                   const NodeVector& args,
+                                   const vector<bool>& batched,
+                                   size_t batch_size,
+                                   size_t slice_size)
+{
+    auto all_batched = [&batched]() {
+        for (bool b : batched)
+        {
+            if (!b)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto only_batched = [&batched](size_t index) {
+        for (size_t i = 0; i < batched.size(); i++)
+        {
+            if (batched[i] != (i == index))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (auto softmax = dynamic_pointer_cast<op::Softmax>(node))
+    {
+        return softmax->get_axes().count(0) == 0 ? node->copy_with_new_args(args) : nullptr;
+    }
+    if (dynamic_pointer_cast<op::Result>(node) ||
+        dynamic_pointer_cast<op::util::UnaryElementwise>(node) ||
+        dynamic_pointer_cast<op::util::BinaryElementwise>(node) ||
+        dynamic_pointer_cast<op::Select>(node))
+    {
+        return all_batched() ? node->copy_with_new_args(args) : nullptr;
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::ArithmeticReduction>(node))
+    {
+        return reduction->get_reduction_axes().count(0) == 0 ? node->copy_with_new_args(args)
+                                                              : nullptr;
+    }
+    if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+    {
+        // The reduction axes of the first argument are its last ones
+        bool keeps_batch = dot->get_reduction_axes_count() < node->get_input_shape(0).size();
+        return only_batched(0) && keeps_batch ? node->copy_with_new_args(args) : nullptr;
+    }
+    if (dynamic_pointer_cast<op::Convolution>(node) || dynamic_pointer_cast<op::MaxPool>(node) ||
+        dynamic_pointer_cast<op::AvgPool>(node))
+    {
+        return only_batched(0) ? node->copy_with_new_args(args) : nullptr;
+    }
+    if (auto batch_norm = dynamic_pointer_cast<op::BatchNorm>(node))
+    {
+        // Only inference uses the given mean and variance instead of the batch statistics
+        bool inference = args.size() == 5 && !batch_norm->get_training_flag();
+        return inference && only_batched(2) ? node->copy_with_new_args(args) : nullptr;
+    }
+    if (auto concat = dynamic_pointer_cast<op::Concat>(node))
+    {
+        return all_batched() && concat->get_concatenation_axis() != 0
+                   ? node->copy_with_new_args(args)
+                   : nullptr;
+    }
+    if (auto pad = dynamic_pointer_cast<op::Pad>(node))
+    {
+        bool keeps_batch = pad->get_padding_below()[0] == 0 && pad->get_padding_above()[0] == 0 &&
+                           pad->get_padding_interior()[0] == 0;
+        return only_batched(0) && keeps_batch ? node->copy_with_new_args(args) : nullptr;
+    }
+    if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(node))
+    {
+        if (broadcast->get_broadcast_axes().count(0) != 0)
+        {
+            return nullptr;
+        }
+        Shape shape = broadcast->get_broadcast_shape();
+        shape[0] = slice_size;
+        return make_shared<op::Broadcast>(args[0], shape, broadcast->get_broadcast_axes());
+    }
+    if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+    {
+        // Permuting or regrouping the other axes keeps every entry of the batch contiguous
+        Shape shape = reshape->get_output_shape();
+        if (reshape->get_input_order()[0] != 0 || shape.empty() || shape[0] != batch_size)
+        {
+            return nullptr;
+        }
+        shape[0] = slice_size;
+        return make_shared<op::Reshape>(args[0], reshape->get_input_order(), shape);
+    }
+    if (auto slice = dynamic_pointer_cast<op::Slice>(node))
+    {
+        Coordinate upper_bounds = slice->get_upper_bounds();
+        if (slice->get_lower_bounds()[0] != 0 || upper_bounds[0] != batch_size ||
+            slice->get_strides()[0] != 1)
+        {
+            return nullptr;
+        }
+        upper_bounds[0] = slice_size;
+        return make_shared<op::Slice>(
+            args[0], slice->get_lower_bounds(), upper_bounds, slice->get_strides());
+    }
+    return nullptr;
+}
+
+size_t runtime::cpu::get_batch_size(const shared_ptr<Function>& func)
+{
+    const auto& parameters = func->get_parameters();
+    if (parameters.empty())
+    {
+        throw ngraph_error(func->get_name() + " has no parameters to take a batch from");
+    }
+    size_t batch_size = 0;
+    for (auto parameter : parameters)
+    {
+        const Shape& shape = parameter->get_shape();
+        if (shape.empty() || (batch_size != 0 && shape[0] != batch_size))
+        {
+            throw ngraph_error("The parameters of " + func->get_name() +
+                               " do not share a batch axis");
+        }
+        batch_size = shape[0];
+    }
+    return batch_size;
+}
+
+shared_ptr<Function> runtime::cpu::slice_batch(const shared_ptr<Function>& func,
+                                               size_t slice_size)
+{
+    const auto& parameters = func->get_parameters();
+    size_t batch_size = get_batch_size(func);
+    if (slice_size == 0 || slice_size > batch_size)
+    {
+        throw ngraph_error("Cannot cut the batch of " + func->get_name() + " to " +
+                           to_string(slice_size) + " entries");
+    }
+
+    // The nodes whose output carries the batch axis as its axis 0
+    unordered_set<shared_ptr<Node>> batched_nodes;
+    NodeMap node_map;
+    for (auto node : topological_sort(func->get_ops()))
+    {
+        NodeVector args;
+        vector<bool> batched;
+        for (auto arg : node->get_arguments())
+        {
+            args.push_back(node_map.get(arg));
+            batched.push_back(batched_nodes.count(arg) != 0);
+        }
+
+        shared_ptr<Node> sliced;
+        if (auto parameter = dynamic_pointer_cast<op::Parameter>(node))
+        {
+            Shape shape = parameter->get_shape();
+            shape[0] = slice_size;
+            sliced = make_shared<op::Parameter>(
+                parameter->get_element_type(), shape, parameter->get_cacheable());
+            batched_nodes.insert(node);
+        }
+        else if (find(batched.begin(), batched.end(), true) != batched.end())
+        {
+            sliced = slice_node(node, args, batched, batch_size, slice_size);
+            if (!sliced)
+            {
+                throw ngraph_error(func->get_name() + " is not batch-separable: " +
+                                   node->get_name() + " mixes the entries of the batch");
+            }
+            batched_nodes.insert(node);
+        }
+        else
+        {
+            auto broadcast = dynamic_pointer_cast<op::Broadcast>(node);
+            if (broadcast && broadcast->get_broadcast_axes().count(0) != 0 &&
+                broadcast->get_broadcast_shape()[0] == batch_size)
+            {
+                // Every entry of a broadcast along the batch axis is the same, as for a bias
+                Shape shape = broadcast->get_broadcast_shape();
+                shape[0] = slice_size;
+                sliced =
+                    make_shared<op::Broadcast>(args[0], shape, broadcast->get_broadcast_axes());
+                batched_nodes.insert(node);
+            }
+            else
+            {
+                sliced = node->copy_with_new_args(args);
+            }
+        }
+        node_map.add(node, sliced);
+    }
+
+    ResultVector results;
+    for (auto result : func->get_results())
+    {
+        if (batched_nodes.count(result) == 0)
+        {
+            throw ngraph_error(func->get_name() + " is not batch-separable: " +
+                               result->get_name() + " does not carry the batch axis");
+        }
+        results.push_back(static_pointer_cast<op::Result>(node_map.get(result)));
+    }
+    op::ParameterVector sliced_parameters;
+    for (auto parameter : parameters)
+    {
+        sliced_parameters.push_back(static_pointer_cast<op::Parameter>(node_map.get(parameter)));
+    }
+    return make_shared<Function>(results, sliced_parameters);
+}
+
+runtime::cpu::MicroBatchSlice::MicroBatchSlice(const shared_ptr<CPU_CallFrame>& call_frame,
+                                               size_t batch_begin,
+                                               size_t batch_size,
+                                               size_t part,
+                                               size_t num_parts)
+    : m_call_frame(call_frame)
+    , m_batch_begin(batch_begin)
+    , m_batch_size(batch_size)
+    , m_pending(false)
+    , m_shutdown(false)
+{
+    auto& backend_pool = CPUThreadPool::get();
+    size_t num_threads = backend_pool.get_num_threads();
+    size_t first_thread = part * num_threads / num_parts;
+    size_t last_thread = (part + 1) * num_threads / num_parts;
+    m_pool.reset(new CPUThreadPool(std::max<size_t>(1, last_thread - first_thread),
+                                   backend_pool.get_affinity_part(part, num_parts)));
+    m_call_frame->set_thread_pool(m_pool.get());
+    m_thread = thread(&MicroBatchSlice::work, this);
+}
+
+runtime::cpu::MicroBatchSlice::~MicroBatchSlice()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+}
+
+// Views of the entries of the batch axis of tvs that belong to the slice
+vector<shared_ptr<runtime::TensorView>> runtime::cpu::MicroBatchSlice::slice(
+    const vector<shared_ptr<runtime::TensorView>>& tvs) const
+{
+    vector<shared_ptr<runtime::TensorView>> slices;
+    for (auto& tv : tvs)
+    {
+        auto cpu_tv = static_pointer_cast<CPUTensorView>(tv);
+        const element::Type& element_type = cpu_tv->get_element_type();
+        Shape shape = tv->get_shape();
+        size_t entry_size = shape_size(shape) / shape[0] * element_type.size();
+        shape[0] = m_batch_size;
+        auto slice_tv = make_shared<CPUTensorView>(
+            element_type, shape, cpu_tv->get_data_ptr() + m_batch_begin * entry_size);
+        slice_tv->set_stale(tv->get_stale());
+        slices.push_back(slice_tv);
+    }
+    return slices;
+}
+
+void runtime::cpu::MicroBatchSlice::start(const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                          const vector<shared_ptr<runtime::TensorView>>& inputs,
+                                          size_t num_threads)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_outputs = slice(outputs);
+        m_inputs = slice(inputs);
+        m_call_frame->set_num_threads(num_threads);
+        m_exception = nullptr;
+        m_pending = true;
+    }
+    m_condition.notify_all();
+}
+
+void runtime::cpu::MicroBatchSlice::wait()
+{
+    unique_lock<mutex> lock(m_mutex);
+    m_condition.wait(lock, [this]() { return !m_pending; });
+    m_outputs.clear();
+    m_inputs.clear();
+    if (m_exception)
+    {
+        rethrow_exception(m_exception);
+    }
+}
+
+void runtime::cpu::MicroBatchSlice::work()
+{
+    m_pool->bind_current_thread();
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait(lock, [this]() { return m_pending || m_shutdown; });
+        if (!m_pending)
+        {
+            return;
+        }
+        lock.unlock();
+        exception_ptr exception;
+        try
+        {
+            m_call_frame->call(m_outputs, m_inputs);
+        }
+        catch (...)
+        {
+            exception = current_exception();
+        }
+        lock.lock();
+        m_exception = exception;
+        m_pending = false;
+        m_condition.notify_all();
+    }
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_CallFrame;
+            class CPUThreadPool;
+
+            /// \brief Returns the size of the batch axis, axis 0 of every parameter of func.
+            ///        Throws ngraph_error if the parameters do not share it.
+            size_t get_batch_size(const std::shared_ptr<Function>& func);
+
+            /// \brief Clones func with the batch axis, axis 0 of every parameter and result, cut
+            ///        to slice_size entries, so that call frames of the clone compute consecutive
+            ///        slices of the batch of func independently.
+            ///
+            /// Throws ngraph_error if func is not batch-separable: if its parameters do not
+            /// share a batch axis, if a result does not carry the batch axis, or if an op mixes
+            /// the entries of the batch, such as a reduction, softmax, concatenation or slice
+            /// along the batch axis, or an op not known to keep the entries apart.
+            std::shared_ptr<Function> slice_batch(const std::shared_ptr<Function>& func,
+                                                  size_t slice_size);
+
+            /// \brief Computes one slice of the batch of a micro-batched call on a thread of its
+            ///        own, which runs the Eigen kernels of the slice on a CPUThreadPool of its
+            ///        own. The thread and the pool get part number part of num_parts disjoint
+            ///        parts of the threads of the backend pool and, if it is pinned, of its
+            ///        CPUs, where the OpenMP threads of the MKLDNN primitives and cblas calls
+            ///        the thread starts stay as well.
+            class MicroBatchSlice
+            {
+            public:
+                /// \param call_frame Computes the slice, with the batch cut to batch_size.
+                /// \param batch_begin The first entry of the batch in the slice.
+                MicroBatchSlice(const std::shared_ptr<CPU_CallFrame>& call_frame,
+                                size_t batch_begin,
+                                size_t batch_size,
+                                size_t part,
+                                size_t num_parts);
+                ~MicroBatchSlice();
+
+                /// \brief Starts computing the slice of outputs from the slice of inputs.
+                void start(const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs,
+                           size_t num_threads);
+                /// \brief Waits for the computation started last and rethrows its exception.
+                void wait();
+
+                CPU_CallFrame& get_call_frame() { return *m_call_frame; }
+                CPUThreadPool& get_thread_pool() { return *m_pool; }
+            private:
+                MicroBatchSlice(const MicroBatchSlice&) = delete;
+                MicroBatchSlice& operator=(const MicroBatchSlice&) = delete;
+
+                std::vector<std::shared_ptr<runtime::TensorView>>
+                    slice(const std::vector<std::shared_ptr<runtime::TensorView>>& tvs) const;
+                void work();
+
+                std::shared_ptr<CPU_CallFrame> m_call_frame;
+                size_t m_batch_begin;
+                size_t m_batch_size;
+                std::unique_ptr<CPUThreadPool> m_pool;
+                std::vector<std::shared_ptr<runtime::TensorView>> m_outputs;
+                std::vector<std::shared_ptr<runtime::TensorView>> m_inputs;
+                std::exception_ptr m_exception;
+                bool m_pending;
+                bool m_shutdown;
+                std::mutex m_mutex;
+                std::condition_variable m_condition;
+                std::thread m_thread;
+            };
+        }
+    }
+}
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 namespace mkldnn
 {
@@ -38,6 +39,9 @@ namespace ngraph
     {
         namespace cpu
         {
+            struct MKLDNNInvocation;
+            class TaskGraph;
+
             typedef std::chrono::high_resolution_clock Clock;
             typedef std::chrono::time_point<Clock> Timestamp;
             typedef std::chrono::microseconds Timescale;
@@ -50,6 +54,12 @@ namespace ngraph
                 mkldnn::primitive* const* mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
                 char* const* mkldnn_workspaces;
+                // MKLDNN primitives may be shared with other call frames and functions, so
+                // set_memory_ptr records the data handles of this frame and
+                // mkldnn_invoke_primitive binds them under the primitive's lock
+                const MKLDNNInvocation* mkldnn_invocations;
+                void** mkldnn_bindings;
+                const TaskGraph* task_graph;
             };
             }
         }
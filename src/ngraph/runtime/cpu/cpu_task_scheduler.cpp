@@ -0,0 +1,349 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_task_scheduler.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+
+using namespace ngraph::runtime::cpu;
+
+static const size_t s_external_thread = static_cast<size_t>(-1);
+
+// Index of the pool worker running on this thread
+static thread_local size_t t_worker_index = s_external_thread;
+
+TaskGraph::TaskGraph(size_t num_tasks)
+    : m_successors(num_tasks)
+    , m_num_predecessors(num_tasks, 0)
+    , m_costs(num_tasks, 1.0)
+    , m_priorities(num_tasks, 0.0)
+{
+}
+
+void TaskGraph::add_dependency(size_t producer, size_t consumer)
+{
+    if (producer >= consumer)
+    {
+        throw ngraph_error("Task dependencies must follow the order of the tasks");
+    }
+    auto& successors = m_successors.at(producer);
+    if (std::find(successors.begin(), successors.end(), consumer) == successors.end())
+    {
+        successors.push_back(consumer);
+        m_num_predecessors.at(consumer)++;
+    }
+}
+
+void TaskGraph::finalize()
+{
+    // Tasks are numbered in topological order, so a reverse sweep sees every successor
+    // before its predecessors
+    for (size_t i = m_successors.size(); i-- > 0;)
+    {
+        double longest = 0.0;
+        for (size_t successor : m_successors[i])
+        {
+            longest = std::max(longest, m_priorities[successor]);
+        }
+        m_priorities[i] = m_costs[i] + longest;
+    }
+    m_roots.clear();
+    for (size_t i = 0; i < m_successors.size(); i++)
+    {
+        if (m_num_predecessors[i] == 0)
+        {
+            m_roots.push_back(i);
+        }
+    }
+}
+
+bool TaskGraph::has_concurrency() const
+{
+    if (m_roots.size() > 1)
+    {
+        return true;
+    }
+    for (auto& successors : m_successors)
+    {
+        if (successors.size() > 1)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct TaskScheduler::Execution
+{
+    const TaskGraph* graph;
+    const TaskFunction* function;
+    size_t num_threads;
+    std::unique_ptr<std::atomic<size_t>[]> pending;
+    std::atomic<size_t> remaining;
+    std::atomic<bool> failed;
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+    // Guarded by the scheduler's m_mutex
+    bool done;
+};
+
+size_t TaskScheduler::get_inter_op_parallelism()
+{
+    const auto parallelism = std::getenv("NGRAPH_CPU_INTER_OP_PARALLELISM");
+    int count;
+    if (parallelism && (count = std::atoi(parallelism)) > 0)
+    {
+        return count;
+    }
+    return 1;
+}
+
+TaskScheduler& TaskScheduler::get()
+{
+    static TaskScheduler scheduler(get_inter_op_parallelism());
+    return scheduler;
+}
+
+// The calling thread of execute() takes part in the work, so num_threads - 1 workers are
+// started. The last deque takes the jobs pushed by threads outside the pool.
+TaskScheduler::TaskScheduler(size_t num_threads)
+    : m_running(0)
+    , m_queued(0)
+    , m_shutdown(false)
+{
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        m_workers.emplace_back(new Worker);
+    }
+    for (size_t i = 0; i + 1 < num_threads; i++)
+    {
+        m_threads.emplace_back(&TaskScheduler::work, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_condition.notify_all();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+size_t TaskScheduler::get_worker_index() const
+{
+    return t_worker_index == s_external_thread ? m_workers.size() - 1 : t_worker_index;
+}
+
+void TaskScheduler::push(size_t index, const Job& job)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_workers[index]->mutex);
+        m_workers[index]->jobs.push_back(job);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued++;
+    }
+    m_condition.notify_one();
+}
+
+// Owners take their most recently pushed job, which is the most critical of the last batch
+// of ready tasks
+bool TaskScheduler::pop(size_t index, Job& job)
+{
+    std::lock_guard<std::mutex> lock(m_workers[index]->mutex);
+    auto& jobs = m_workers[index]->jobs;
+    if (jobs.empty())
+    {
+        return false;
+    }
+    job = jobs.back();
+    jobs.pop_back();
+    m_queued--;
+    return true;
+}
+
+bool TaskScheduler::steal(size_t index, Job& job)
+{
+    for (size_t i = 1; i < m_workers.size(); i++)
+    {
+        size_t victim = (index + i) % m_workers.size();
+        std::lock_guard<std::mutex> lock(m_workers[victim]->mutex);
+        auto& jobs = m_workers[victim]->jobs;
+        if (!jobs.empty())
+        {
+            job = jobs.front();
+            jobs.pop_front();
+            m_queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::work(size_t index)
+{
+    t_worker_index = index;
+    CPUThreadPool::get().bind_current_thread();
+    while (true)
+    {
+        Job job;
+        if (pop(index, job) || steal(index, job))
+        {
+            run(index, job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_queued > 0 || m_shutdown; });
+        if (m_shutdown)
+        {
+            return;
+        }
+    }
+}
+
+void TaskScheduler::run(size_t index, Job job)
+{
+    Execution& execution = *job.execution;
+    const TaskGraph& graph = *execution.graph;
+    std::vector<size_t> ready;
+    while (true)
+    {
+        if (!execution.failed)
+        {
+            // Split the threads of the call between the tasks in flight and the ones waiting
+            size_t in_flight = ++m_running + m_queued;
+            int num_threads = static_cast<int>(
+                std::max<size_t>(1, execution.num_threads / std::max<size_t>(1, in_flight)));
+            try
+            {
+                (*execution.function)(job.task, num_threads);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(execution.exception_mutex);
+                if (!execution.exception)
+                {
+                    execution.exception = std::current_exception();
+                }
+                execution.failed = true;
+            }
+            m_running--;
+        }
+
+        ready.clear();
+        for (size_t successor : graph.get_successors(job.task))
+        {
+            if (--execution.pending[successor] == 0)
+            {
+                ready.push_back(successor);
+            }
+        }
+        std::sort(ready.begin(), ready.end(), [&graph](size_t a, size_t b) {
+            return graph.get_priority(a) < graph.get_priority(b);
+        });
+
+        // Continue with the most critical successor and leave the others to be stolen
+        bool has_next = !ready.empty();
+        if (has_next)
+        {
+            job.task = ready.back();
+            ready.pop_back();
+            for (size_t task : ready)
+            {
+                push(index, {&execution, task});
+            }
+        }
+
+        // Once remaining drops to zero the caller may return and destroy the execution
+        if (--execution.remaining == 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                execution.done = true;
+            }
+            m_condition.notify_all();
+        }
+        if (!has_next)
+        {
+            return;
+        }
+    }
+}
+
+void TaskScheduler::execute(const TaskGraph& graph,
+                            const TaskFunction& function,
+                            size_t num_threads)
+{
+    size_t num_tasks = graph.get_num_tasks();
+    if (num_tasks == 0)
+    {
+        return;
+    }
+
+    Execution execution;
+    execution.graph = &graph;
+    execution.function = &function;
+    execution.num_threads = num_threads;
+    execution.pending.reset(new std::atomic<size_t>[num_tasks]);
+    for (size_t i = 0; i < num_tasks; i++)
+    {
+        execution.pending[i] = graph.get_num_predecessors(i);
+    }
+    execution.remaining = num_tasks;
+    execution.failed = false;
+    execution.done = false;
+
+    size_t index = get_worker_index();
+    std::vector<size_t> roots = graph.get_roots();
+    std::sort(roots.begin(), roots.end(), [&graph](size_t a, size_t b) {
+        return graph.get_priority(a) < graph.get_priority(b);
+    });
+    for (size_t task : roots)
+    {
+        push(index, {&execution, task});
+    }
+
+    while (true)
+    {
+        Job job;
+        if (pop(index, job) || steal(index, job))
+        {
+            run(index, job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [&]() { return m_queued > 0 || execution.done; });
+        if (execution.done)
+        {
+            break;
+        }
+    }
+
+    if (execution.exception)
+    {
+        std::rethrow_exception(execution.exception);
+    }
+}
@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Dependency graph of the ops of a compiled function, built once at
+            ///        compile time and executed by the TaskScheduler on every call.
+            class TaskGraph
+            {
+            public:
+                TaskGraph(size_t num_tasks);
+
+                void add_dependency(size_t producer, size_t consumer);
+                void set_cost(size_t task, double cost) { m_costs.at(task) = cost; }
+                /// \brief Computes the roots and the critical path priority of every task,
+                ///        which is the cost of the most expensive path from the task to a sink.
+                void finalize();
+
+                size_t get_num_tasks() const { return m_successors.size(); }
+                const std::vector<size_t>& get_successors(size_t task) const
+                {
+                    return m_successors[task];
+                }
+                size_t get_num_predecessors(size_t task) const
+                {
+                    return m_num_predecessors[task];
+                }
+                double get_priority(size_t task) const { return m_priorities[task]; }
+                const std::vector<size_t>& get_roots() const { return m_roots; }
+                /// \brief False if the graph is a single chain, which gains nothing from
+                ///        the scheduler.
+                bool has_concurrency() const;
+
+            private:
+                std::vector<std::vector<size_t>> m_successors;
+                std::vector<size_t> m_num_predecessors;
+                std::vector<double> m_costs;
+                std::vector<double> m_priorities;
+                std::vector<size_t> m_roots;
+            };
+
+            /// \brief Runs task with the number of intra-op threads its kernels may use.
+            using TaskFunction = std::function<void(size_t task, int num_threads)>;
+
+            /// \brief Process wide work-stealing pool that runs independent ops of a TaskGraph
+            ///        concurrently.
+            ///
+            /// The scheduler is enabled by setting NGRAPH_CPU_INTER_OP_PARALLELISM to the number
+            /// of ops that may run at once. Ready tasks are run in critical path order, a task
+            /// with a single ready successor continues with it on the same thread so chains
+            /// execute sequentially, and the intra-op threads of the call are divided between the
+            /// tasks in flight.
+            class TaskScheduler
+            {
+            public:
+                static TaskScheduler& get();
+                /// \brief The value of NGRAPH_CPU_INTER_OP_PARALLELISM, or 1 if it is unset.
+                static size_t get_inter_op_parallelism();
+
+                ~TaskScheduler();
+
+                /// \brief Runs every task of graph once its predecessors are done and returns
+                ///        when all of them are. The calling thread takes part in the work.
+                ///        The first exception thrown by a task is rethrown and the tasks
+                ///        that did not start yet are skipped.
+                /// \param num_threads The intra-op threads divided between the tasks.
+                void execute(const TaskGraph& graph,
+                             const TaskFunction& function,
+                             size_t num_threads);
+
+            private:
+                struct Execution;
+                struct Job
+                {
+                    Execution* execution;
+                    size_t task;
+                };
+                struct Worker
+                {
+                    std::mutex mutex;
+                    std::deque<Job> jobs;
+                };
+
+                TaskScheduler(size_t num_threads);
+                TaskScheduler(const TaskScheduler&) = delete;
+                TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+                void work(size_t index);
+                size_t get_worker_index() const;
+                void push(size_t index, const Job& job);
+                bool pop(size_t index, Job& job);
+                bool steal(size_t index, Job& job);
+                void run(size_t index, Job job);
+
+                std::vector<std::unique_ptr<Worker>> m_workers;
+                std::vector<std::thread> m_threads;
+                std::atomic<size_t> m_running;
+                // Jobs waiting in the deques. Incremented under m_mutex so sleeping threads
+                // never miss a wakeup
+                std::atomic<size_t> m_queued;
+                std::mutex m_mutex;
+                std::condition_variable m_condition;
+                bool m_shutdown;
+            };
+        }
+    }
+}
@@ -22,6 +22,7 @@
 #include "ngraph/descriptor/primary_tensor_view.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/shape.hpp"
 
@@ -75,6 +76,7 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
 #endif
 
         aligned_buffer = static_cast<char*>(ptr);
+        CPUThreadPool::get().first_touch(aligned_buffer, buffer_size);
     }
 }
 
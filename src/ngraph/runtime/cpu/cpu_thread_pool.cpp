@@ -0,0 +1,404 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef NGRAPH_TBB_ENABLE
+#define TBB_PREVIEW_GLOBAL_CONTROL 1
+#include <tbb/global_control.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+
+using namespace ngraph::runtime::cpu;
+
+// The OpenMP runtime is loaded with MKLDNN rather than linked into the backend
+extern "C" int omp_get_max_threads() __attribute__((weak));
+extern "C" void omp_set_num_threads(int) __attribute__((weak));
+
+// The pool of the pool thread running on this thread and its index
+static thread_local const CPUThreadPool* t_pool = nullptr;
+static thread_local int t_thread_id = -1;
+
+// The bounded pool of the runner running on this thread and its slot
+static thread_local const BoundedThreadPool* t_bounded_pool = nullptr;
+static thread_local int t_bounded_slot = -1;
+
+#ifdef NGRAPH_TBB_ENABLE
+static std::unique_ptr<tbb::global_control> s_tbb_parallelism;
+#endif
+
+static size_t get_default_num_threads()
+{
+    const auto omp_num_threads = std::getenv("OMP_NUM_THREADS");
+    int count;
+
+    if (omp_num_threads && (count = std::atoi(omp_num_threads)) > 0)
+    {
+        return count;
+    }
+    count = std::thread::hardware_concurrency() >> 1;
+    return count ? count : 1;
+}
+
+static void pin_to_cpus(const std::vector<int>& cpus)
+{
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (int cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &mask);
+        }
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) != 0)
+    {
+        NGRAPH_WARN << "Could not pin a thread to the CPU set starting at " << cpus.front();
+    }
+#else
+    NGRAPH_WARN << "Thread affinity is not supported on this platform";
+#endif
+}
+
+std::vector<int> CPUThreadPool::parse_cpu_list(const std::string& list)
+{
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ','))
+    {
+        int first;
+        int last;
+        char dash;
+        std::stringstream rs(range);
+        if (!(rs >> first))
+        {
+            throw ngraph_error("Invalid CPU list '" + list + "'");
+        }
+        last = first;
+        if (rs >> dash && (dash != '-' || !(rs >> last)))
+        {
+            throw ngraph_error("Invalid CPU list '" + list + "'");
+        }
+        if (first < 0 || last < first)
+        {
+            throw ngraph_error("Invalid CPU list '" + list + "'");
+        }
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+CPUThreadPool& CPUThreadPool::get()
+{
+    static CPUThreadPool pool;
+    return pool;
+}
+
+// The Eigen device is constructed from the pool during static initialization, so only
+// configure() may update it
+CPUThreadPool::CPUThreadPool()
+    : m_shutdown(false)
+    , m_is_global(true)
+{
+    const auto affinity = std::getenv("NGRAPH_CPU_AFFINITY");
+    if (affinity)
+    {
+        m_cpus = parse_cpu_list(affinity);
+    }
+    bool one_per_cpu = !m_cpus.empty() && !std::getenv("OMP_NUM_THREADS");
+    start(one_per_cpu ? m_cpus.size() : get_default_num_threads());
+}
+
+CPUThreadPool::CPUThreadPool(size_t num_threads, const std::vector<int>& cpus)
+    : m_cpus(cpus)
+    , m_shutdown(false)
+    , m_is_global(false)
+{
+    if (num_threads == 0)
+    {
+        throw ngraph_error("The CPU thread pool needs at least one thread");
+    }
+    start(num_threads);
+}
+
+CPUThreadPool::~CPUThreadPool()
+{
+    stop();
+}
+
+void CPUThreadPool::configure(size_t num_threads, const std::vector<int>& cpus)
+{
+    if (num_threads == 0)
+    {
+        throw ngraph_error("The CPU thread pool needs at least one thread");
+    }
+    stop();
+    m_cpus = cpus;
+    start(num_threads);
+    if (m_is_global)
+    {
+        eigen::global_thread_pool_device =
+            Eigen::ThreadPoolDevice(this, static_cast<int>(num_threads));
+        eigen::update_parallel_thresholds();
+    }
+}
+
+void CPUThreadPool::start(size_t num_threads)
+{
+    m_shutdown = false;
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        m_threads.emplace_back(&CPUThreadPool::work, this, i);
+    }
+#ifdef NGRAPH_TBB_ENABLE
+    if (m_is_global)
+    {
+        s_tbb_parallelism.reset();
+        s_tbb_parallelism.reset(
+            new tbb::global_control(tbb::global_control::max_allowed_parallelism, num_threads));
+    }
+#endif
+}
+
+// Closures already scheduled are run before the threads exit, since Eigen waits for them
+void CPUThreadPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_condition.notify_all();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+    m_threads.clear();
+}
+
+void CPUThreadPool::work(size_t index)
+{
+    t_pool = this;
+    t_thread_id = static_cast<int>(index);
+    if (!m_cpus.empty())
+    {
+        pin_to_cpus({m_cpus[index % m_cpus.size()]});
+    }
+    while (true)
+    {
+        std::function<void()> fn;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return !m_queue.empty() || m_shutdown; });
+            if (m_queue.empty())
+            {
+                return;
+            }
+            fn = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        fn();
+    }
+}
+
+void CPUThreadPool::Schedule(std::function<void()> fn)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(fn));
+    }
+    m_condition.notify_one();
+}
+
+void CPUThreadPool::bind_current_thread() const
+{
+    if (!m_cpus.empty())
+    {
+        pin_to_cpus(m_cpus);
+    }
+}
+
+std::vector<int> CPUThreadPool::get_affinity_part(size_t part, size_t num_parts) const
+{
+    if (m_cpus.empty())
+    {
+        return {};
+    }
+    // With fewer CPUs than parts, some parts share a CPU
+    size_t begin = part * m_cpus.size() / num_parts;
+    size_t end = std::max(begin + 1, (part + 1) * m_cpus.size() / num_parts);
+    return std::vector<int>(m_cpus.begin() + begin, m_cpus.begin() + end);
+}
+
+// Linux places a page on the NUMA node of the thread that touches it first
+void CPUThreadPool::first_touch(void* buffer, size_t size)
+{
+    if (m_cpus.empty() || size == 0)
+    {
+        return;
+    }
+    // A pool thread waiting for the others could wait for itself
+    if (t_pool == this)
+    {
+        std::memset(buffer, 0, size);
+        return;
+    }
+    size_t num_chunks = m_threads.size();
+    size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+    Eigen::Barrier barrier(static_cast<unsigned int>(num_chunks));
+    for (size_t i = 0; i < num_chunks; i++)
+    {
+        size_t begin = std::min(size, i * chunk_size);
+        size_t end = std::min(size, begin + chunk_size);
+        Schedule([&barrier, buffer, begin, end]() {
+            std::memset(static_cast<char*>(buffer) + begin, 0, end - begin);
+            barrier.Notify();
+        });
+    }
+    barrier.Wait();
+}
+
+int CPUThreadPool::NumThreads() const
+{
+    return static_cast<int>(m_threads.size());
+}
+
+int CPUThreadPool::CurrentThreadId() const
+{
+    return t_pool == this ? t_thread_id : -1;
+}
+
+BoundedThreadPool::BoundedThreadPool(Eigen::ThreadPoolInterface& pool, int num_threads)
+    : m_pool(pool)
+    , m_num_threads(num_threads)
+{
+    if (num_threads <= 0)
+    {
+        throw ngraph_error("A bounded thread pool needs at least one thread");
+    }
+    for (int slot = num_threads - 1; slot >= 0; slot--)
+    {
+        m_free_slots.push_back(slot);
+    }
+}
+
+// Eigen waits for its closures, but a runner may still be on its way out of run()
+BoundedThreadPool::~BoundedThreadPool()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() {
+        return m_free_slots.size() == static_cast<size_t>(m_num_threads);
+    });
+}
+
+void BoundedThreadPool::Schedule(std::function<void()> fn)
+{
+    int slot;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(fn));
+        if (m_free_slots.empty())
+        {
+            return;
+        }
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    }
+    m_pool.Schedule([this, slot]() { run(slot); });
+}
+
+// Drains the queue, so a closure scheduled while all runners are busy is picked up by the
+// first one to finish
+void BoundedThreadPool::run(int slot)
+{
+    const BoundedThreadPool* previous_pool = t_bounded_pool;
+    int previous_slot = t_bounded_slot;
+    t_bounded_pool = this;
+    t_bounded_slot = slot;
+    while (true)
+    {
+        std::function<void()> fn;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_queue.empty())
+            {
+                m_free_slots.push_back(slot);
+                if (m_free_slots.size() == static_cast<size_t>(m_num_threads))
+                {
+                    m_idle.notify_all();
+                }
+                break;
+            }
+            fn = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        fn();
+    }
+    t_bounded_pool = previous_pool;
+    t_bounded_slot = previous_slot;
+}
+
+int BoundedThreadPool::NumThreads() const
+{
+    return m_num_threads;
+}
+
+int BoundedThreadPool::CurrentThreadId() const
+{
+    return t_bounded_pool == this ? t_bounded_slot : -1;
+}
+
+// Eigen schedules several blocks per thread of the device on its pool, so a device on the
+// whole pool with fewer threads would still spread a kernel over all of them
+CPUThreadPool::ThreadLimit::ThreadLimit(int num_threads, CPUThreadPool& pool)
+    : m_previous(omp_get_max_threads ? omp_get_max_threads() : 0)
+    , m_bounded_pool(num_threads < pool.NumThreads() ? new BoundedThreadPool(pool, num_threads)
+                                                     : nullptr)
+    , m_device(m_bounded_pool ? static_cast<Eigen::ThreadPoolInterface*>(m_bounded_pool.get())
+                              : &pool,
+               num_threads)
+    , m_previous_device(eigen::set_thread_pool_device(&m_device))
+{
+    if (omp_set_num_threads)
+    {
+        omp_set_num_threads(num_threads);
+    }
+}
+
+CPUThreadPool::ThreadLimit::~ThreadLimit()
+{
+    eigen::set_thread_pool_device(m_previous_device);
+    if (omp_set_num_threads && m_previous > 0)
+    {
+        omp_set_num_threads(m_previous);
+    }
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Runs the closures scheduled on it on the threads of another pool, at
+            ///        most num_threads of them at a time.
+            ///
+            /// Closures wait in a queue of their own until one of the num_threads runners it
+            /// keeps on the other pool is free, so an Eigen device built on it never occupies
+            /// more than num_threads threads of the other pool, however many blocks a kernel
+            /// is split into.
+            class BoundedThreadPool : public Eigen::ThreadPoolInterface
+            {
+            public:
+                BoundedThreadPool(Eigen::ThreadPoolInterface& pool, int num_threads);
+                /// \brief Waits for the runners to return to the other pool.
+                ~BoundedThreadPool();
+
+                void Schedule(std::function<void()> fn) override;
+                int NumThreads() const override;
+                int CurrentThreadId() const override;
+
+            private:
+                BoundedThreadPool(const BoundedThreadPool&) = delete;
+                BoundedThreadPool& operator=(const BoundedThreadPool&) = delete;
+
+                void run(int slot);
+
+                Eigen::ThreadPoolInterface& m_pool;
+                int m_num_threads;
+                std::deque<std::function<void()>> m_queue;
+                // The ids of the runners not scheduled on the other pool
+                std::vector<int> m_free_slots;
+                std::mutex m_mutex;
+                std::condition_variable m_idle;
+            };
+
+            /// \brief The threads of the CPU backend.
+            ///
+            /// Eigen kernels run on the pool through eigen::global_thread_pool_device, and the
+            /// OpenMP regions of MKLDNN and cblas, the intra-op budgets of the TaskScheduler
+            /// and the TBB flow graph are limited to its size, so the threading runtimes of the
+            /// backend share one set of cores instead of oversubscribing them. The pool starts
+            /// with OMP_NUM_THREADS threads, or one per physical core if it is unset.
+            ///
+            /// Setting NGRAPH_CPU_AFFINITY to a CPU list such as "0-13,28-41" pins the threads
+            /// to those CPUs, with one thread per CPU unless OMP_NUM_THREADS says otherwise.
+            /// While the threads are pinned, the memory pools and tensors of call frames and
+            /// the constants of compiled functions are first touched by the pool, so their
+            /// pages are placed on the NUMA node of the CPU set.
+            ///
+            /// Work that must stay off the threads of the backend pool, such as a slice of a
+            /// micro-batched call, can run its Eigen kernels on a pool of its own through a
+            /// ThreadLimit.
+            class CPUThreadPool : public Eigen::ThreadPoolInterface
+            {
+            public:
+                static CPUThreadPool& get();
+                /// \brief Parses a CPU list in the format of /sys/devices/system/node/*/cpulist.
+                static std::vector<int> parse_cpu_list(const std::string& list);
+
+                /// \brief Creates a pool separate from the one of get().
+                CPUThreadPool(size_t num_threads, const std::vector<int>& cpus = {});
+                ~CPUThreadPool();
+
+                /// \brief Restarts the pool with num_threads threads. Must not be called while
+                ///        a call is running.
+                /// \param cpus The CPUs the threads are pinned to, round robin. The threads
+                ///        float freely if it is empty.
+                void configure(size_t num_threads, const std::vector<int>& cpus = {});
+                size_t get_num_threads() const { return m_threads.size(); }
+                const std::vector<int>& get_affinity() const { return m_cpus; }
+                /// \brief Restricts the calling thread to the CPUs of the pool, if it is pinned.
+                void bind_current_thread() const;
+                /// \brief Returns part number part of num_parts disjoint, contiguous parts of
+                ///        the CPUs of the pool, or an empty list if the pool is not pinned.
+                std::vector<int> get_affinity_part(size_t part, size_t num_parts) const;
+                /// \brief Writes zeros to the buffer from the threads of the pool, if it is
+                ///        pinned, so its pages are allocated on the NUMA node of the pool.
+                void first_touch(void* buffer, size_t size);
+                void Schedule(std::function<void()> fn) override;
+                int NumThreads() const override;
+                int CurrentThreadId() const override;
+
+                /// \brief Limits the Eigen kernels and the OpenMP parallel regions the calling
+                ///        thread starts, and with them the MKLDNN primitives and cblas calls it
+                ///        runs, to num_threads threads for the lifetime of the guard. The Eigen
+                ///        kernels run on pool, through a BoundedThreadPool if num_threads is
+                ///        less than its size.
+                class ThreadLimit
+                {
+                public:
+                    ThreadLimit(int num_threads, CPUThreadPool& pool = CPUThreadPool::get());
+                    ~ThreadLimit();
+
+                private:
+                    ThreadLimit(const ThreadLimit&) = delete;
+                    ThreadLimit& operator=(const ThreadLimit&) = delete;
+
+                    int m_previous;
+                    std::unique_ptr<BoundedThreadPool> m_bounded_pool;
+                    Eigen::ThreadPoolDevice m_device;
+                    Eigen::ThreadPoolDevice* m_previous_device;
+                };
+
+            private:
+                CPUThreadPool();
+                CPUThreadPool(const CPUThreadPool&) = delete;
+                CPUThreadPool& operator=(const CPUThreadPool&) = delete;
+
+                void start(size_t num_threads);
+                void stop();
+                void work(size_t index);
+
+                std::vector<std::thread> m_threads;
+                std::vector<int> m_cpus;
+                std::deque<std::function<void()>> m_queue;
+                std::mutex m_mutex;
+                std::condition_variable m_condition;
+                bool m_shutdown;
+                // The pool of get(), which owns the Eigen device and the TBB limit
+                bool m_is_global;
+            };
+        }
+    }
+}
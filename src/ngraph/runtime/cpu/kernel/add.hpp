@@ -43,7 +43,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0 + in1;
+                    eigen::evaluate(eigen::KernelClass::Elementwise, count, out, in0 + in1);
                 }
             }
         }
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Plain loop rather than an Eigen cast so that the f16/bf16 storage types,
+                // which have no Eigen scalar traits, go through their float conversions
+                template <typename InputElementType, typename OutputElementType>
+                void convert(void* input, void* output, size_t count)
+                {
+                    const InputElementType* in = static_cast<const InputElementType*>(input);
+                    OutputElementType* out = static_cast<OutputElementType*>(output);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = static_cast<OutputElementType>(in[i]);
+                    }
+                }
+
+                template <typename InputElementType>
+                void convert_to_float(void* input, void* output, size_t count)
+                {
+                    convert<InputElementType, float>(input, output, count);
+                }
+
+                template <typename InputElementType>
+                void convert_to_double(void* input, void* output, size_t count)
+                {
+                    convert<InputElementType, double>(input, output, count);
+                }
+
+                template <typename InputElementType>
+                void convert_to_f16(void* input, void* output, size_t count)
+                {
+                    convert<InputElementType, ngraph::float16>(input, output, count);
+                }
+
+                template <typename InputElementType>
+                void convert_to_bf16(void* input, void* output, size_t count)
+                {
+                    convert<InputElementType, ngraph::bfloat16>(input, output, count);
+                }
+            }
+        }
+    }
+}
@@ -14,9 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
 
 #include "eigen_thread_pool.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 
 namespace ngraph
 {
@@ -26,25 +34,204 @@ namespace ngraph
         {
             namespace eigen
             {
-                static int GetNumCores()
+                Eigen::ThreadPoolDevice
+                    global_thread_pool_device(&CPUThreadPool::get(),
+                                              CPUThreadPool::get().NumThreads());
+
+                static thread_local Eigen::ThreadPoolDevice* t_thread_pool_device = nullptr;
+
+                Eigen::ThreadPoolDevice& get_thread_pool_device()
+                {
+                    return t_thread_pool_device ? *t_thread_pool_device
+                                                : global_thread_pool_device;
+                }
+
+                Eigen::ThreadPoolDevice* set_thread_pool_device(Eigen::ThreadPoolDevice* device)
+                {
+                    auto previous = t_thread_pool_device;
+                    t_thread_pool_device = device;
+                    return previous;
+                }
+
+                static const size_t s_num_kernel_classes = 3;
+                static const size_t s_max_calibration_size = 1 << 22;
+
+                template <typename Body>
+                static double time_best_of(size_t runs, Body body)
+                {
+                    double best = std::numeric_limits<double>::infinity();
+                    for (size_t i = 0; i < runs; i++)
+                    {
+                        auto start = std::chrono::steady_clock::now();
+                        body();
+                        std::chrono::duration<double> elapsed =
+                            std::chrono::steady_clock::now() - start;
+                        best = std::min(best, elapsed.count());
+                    }
+                    return best;
+                }
+
+                // Doubles the size of a representative kernel of the class until the thread
+                // pool beats the calling thread
+                static size_t measure_threshold(KernelClass kernel_class)
+                {
+                    auto& device = global_thread_pool_device;
+                    if (device.numThreads() <= 1)
+                    {
+                        return std::numeric_limits<size_t>::max();
+                    }
+                    for (size_t size = 256; size <= s_max_calibration_size; size *= 2)
+                    {
+                        Eigen::Tensor<float, 1, Eigen::RowMajor> a(size);
+                        Eigen::Tensor<float, 1, Eigen::RowMajor> b(size);
+                        Eigen::Tensor<float, 1, Eigen::RowMajor> out(size);
+                        Eigen::Tensor<float, 0, Eigen::RowMajor> sum;
+                        a.setRandom();
+                        b.setRandom();
+                        Eigen::array<Eigen::Index, 2> dims{{static_cast<Eigen::Index>(size / 16),
+                                                            16}};
+                        Eigen::array<Eigen::Index, 2> transposed_dims{
+                            {16, static_cast<Eigen::Index>(size / 16)}};
+                        Eigen::array<int, 2> transpose{{1, 0}};
+                        Eigen::TensorMap<Eigen::Tensor<float, 2, Eigen::RowMajor>> matrix(
+                            a.data(), dims);
+                        Eigen::TensorMap<Eigen::Tensor<float, 2, Eigen::RowMajor>> transposed(
+                            out.data(), transposed_dims);
+
+                        double serial = 0;
+                        double parallel = 0;
+                        switch (kernel_class)
+                        {
+                        case KernelClass::Elementwise:
+                            serial = time_best_of(5, [&]() { out = a + b; });
+                            parallel = time_best_of(5, [&]() { out.device(device) = a + b; });
+                            break;
+                        case KernelClass::Reduction:
+                            serial = time_best_of(5, [&]() { sum = a.sum(); });
+                            parallel = time_best_of(5, [&]() { sum.device(device) = a.sum(); });
+                            break;
+                        case KernelClass::Movement:
+                            serial = time_best_of(
+                                5, [&]() { transposed = matrix.shuffle(transpose); });
+                            parallel = time_best_of(5, [&]() {
+                                transposed.device(device) = matrix.shuffle(transpose);
+                            });
+                            break;
+                        }
+                        if (parallel < serial)
+                        {
+                            return size;
+                        }
+                    }
+                    return s_max_calibration_size;
+                }
+
+                class ParallelThresholds
                 {
-                    const auto omp_num_threads = std::getenv("OMP_NUM_THREADS");
-                    int count;
+                public:
+                    ParallelThresholds()
+                        : m_calibrate(false)
+                    {
+                        // Roughly where waking the pool costs as much as the kernel
+                        m_values[static_cast<size_t>(KernelClass::Elementwise)] = 32768;
+                        m_values[static_cast<size_t>(KernelClass::Reduction)] = 16384;
+                        m_values[static_cast<size_t>(KernelClass::Movement)] = 16384;
+
+                        const auto env = std::getenv("NGRAPH_CPU_PARALLEL_THRESHOLDS");
+                        if (!env)
+                        {
+                            return;
+                        }
+                        std::string setting(env);
+                        if (setting == "calibrate")
+                        {
+                            m_calibrate = true;
+                            return;
+                        }
+                        std::stringstream ss(setting);
+                        std::string count;
+                        size_t values[s_num_kernel_classes];
+                        size_t i = 0;
+                        while (i < s_num_kernel_classes && std::getline(ss, count, ','))
+                        {
+                            char* end;
+                            size_t value = std::strtoull(count.c_str(), &end, 10);
+                            if (count.empty() || *end != '\0')
+                            {
+                                NGRAPH_WARN << "Ignoring invalid NGRAPH_CPU_PARALLEL_THRESHOLDS "
+                                            << setting;
+                                return;
+                            }
+                            values[i++] = value;
+                        }
+                        if (i != s_num_kernel_classes)
+                        {
+                            NGRAPH_WARN << "Ignoring incomplete NGRAPH_CPU_PARALLEL_THRESHOLDS "
+                                        << setting;
+                            return;
+                        }
+                        for (i = 0; i < s_num_kernel_classes; i++)
+                        {
+                            m_values[i] = values[i];
+                        }
+                    }
 
-                    if (omp_num_threads && (count = std::atoi(omp_num_threads)))
+                    size_t get(KernelClass kernel_class)
                     {
-                        return count;
+                        return m_values[static_cast<size_t>(kernel_class)];
                     }
-                    else
+
+                    void set(KernelClass kernel_class, size_t num_elements)
                     {
-                        count = std::thread::hardware_concurrency() >> 1;
+                        m_values[static_cast<size_t>(kernel_class)] = num_elements;
                     }
-                    return count ? count : 1;
+
+                    void calibrate()
+                    {
+                        for (size_t i = 0; i < s_num_kernel_classes; i++)
+                        {
+                            m_values[i] = measure_threshold(static_cast<KernelClass>(i));
+                            NGRAPH_DEBUG << "Parallel threshold " << i << ": " << m_values[i];
+                        }
+                    }
+
+                    void update()
+                    {
+                        if (m_calibrate)
+                        {
+                            calibrate();
+                        }
+                    }
+
+                private:
+                    std::atomic<size_t> m_values[s_num_kernel_classes];
+                    bool m_calibrate;
+                };
+
+                static ParallelThresholds& get_thresholds()
+                {
+                    static ParallelThresholds thresholds;
+                    return thresholds;
+                }
+
+                bool use_thread_pool(KernelClass kernel_class, size_t num_elements)
+                {
+                    return get_thread_pool_device().numThreads() > 1 &&
+                           num_elements >= get_parallel_threshold(kernel_class);
+                }
+
+                size_t get_parallel_threshold(KernelClass kernel_class)
+                {
+                    return get_thresholds().get(kernel_class);
+                }
+
+                void set_parallel_threshold(KernelClass kernel_class, size_t num_elements)
+                {
+                    get_thresholds().set(kernel_class, num_elements);
                 }
 
-                Eigen::ThreadPool global_thread_pool(GetNumCores());
-                Eigen::ThreadPoolDevice global_thread_pool_device(&global_thread_pool,
-                                                                  global_thread_pool.NumThreads());
+                void calibrate_parallel_thresholds() { get_thresholds().calibrate(); }
+                void update_parallel_thresholds() { get_thresholds().update(); }
             }
         }
     }
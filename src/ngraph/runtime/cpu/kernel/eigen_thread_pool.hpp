@@ -27,8 +27,61 @@ namespace ngraph
         {
             namespace eigen
             {
-                extern Eigen::ThreadPool global_thread_pool;
+                // Runs on the CPUThreadPool and follows its size
                 extern Eigen::ThreadPoolDevice global_thread_pool_device;
+
+                /// \brief The device Eigen kernels evaluate on: the one installed on this
+                ///        thread by the running call, or global_thread_pool_device.
+                Eigen::ThreadPoolDevice& get_thread_pool_device();
+                /// \brief Installs device on this thread and returns the previous one, which
+                ///        may be nullptr.
+                Eigen::ThreadPoolDevice* set_thread_pool_device(Eigen::ThreadPoolDevice* device);
+
+                /// \brief Kinds of kernels with their own serial/parallel threshold.
+                enum class KernelClass
+                {
+                    Elementwise,
+                    Reduction,
+                    Movement
+                };
+
+                /// \brief True if a kernel touching num_elements elements gains from the
+                ///        thread pool. Smaller kernels run on the calling thread and skip the
+                ///        cost of waking the pool.
+                ///
+                /// NGRAPH_CPU_PARALLEL_THRESHOLDS overrides the default thresholds with the
+                /// element counts for elementwise, reduction and movement kernels, separated by
+                /// commas, or with "calibrate" to measure them when the CPU backend is created
+                /// and again when the CPUThreadPool is reconfigured.
+                bool use_thread_pool(KernelClass kernel_class, size_t num_elements);
+                size_t get_parallel_threshold(KernelClass kernel_class);
+                void set_parallel_threshold(KernelClass kernel_class, size_t num_elements);
+                /// \brief Sets every threshold to the smallest size at which a microbenchmark
+                ///        of its kernel class runs faster on the whole thread pool than
+                ///        serially, or to the largest size_t if the pool has a single thread.
+                void calibrate_parallel_thresholds();
+                /// \brief Calibrates the thresholds if NGRAPH_CPU_PARALLEL_THRESHOLDS asks for
+                ///        it. Kernels never calibrate, so the measurement runs here rather than
+                ///        inside a call and its thread budget.
+                void update_parallel_thresholds();
+
+                /// \brief Evaluates expression into out, on the thread pool if use_thread_pool
+                ///        says so.
+                template <typename Output, typename Expression>
+                void evaluate(KernelClass kernel_class,
+                              size_t num_elements,
+                              Output& out,
+                              const Expression& expression)
+                {
+                    if (use_thread_pool(kernel_class, num_elements))
+                    {
+                        out.device(get_thread_pool_device()) = expression;
+                    }
+                    else
+                    {
+                        out = expression;
+                    }
+                }
             }
         }
     }
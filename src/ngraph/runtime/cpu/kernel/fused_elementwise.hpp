@@ -0,0 +1,215 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Number of elements an instruction processes before moving to the next one.
+                // Scratch values for a block stay in L1.
+                constexpr size_t fused_elementwise_block = 256;
+
+                template <typename ElementType, typename F>
+                void
+                    fused_elementwise_map(const ElementType* a, ElementType* out, size_t count, F f)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = f(a[i]);
+                    }
+                }
+
+                template <typename ElementType, typename F>
+                void fused_elementwise_map(
+                    const ElementType* a, const ElementType* b, ElementType* out, size_t count, F f)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = f(a[i], b[i]);
+                    }
+                }
+
+                template <typename ElementType>
+                void fused_elementwise_instruction(
+                    const ngraph::op::FusedElementwise::Instruction& inst,
+                    const ElementType* const* values,
+                    ElementType* out,
+                    size_t count)
+                {
+                    using T = ElementType;
+                    using Opcode = ngraph::op::FusedElementwise::Opcode;
+                    const T* a = values[inst.operands[0]];
+                    const T* b = inst.operands.size() > 1 ? values[inst.operands[1]] : nullptr;
+                    switch (inst.opcode)
+                    {
+                    case Opcode::Abs:
+                        fused_elementwise_map(a, out, count, [](T x) { return std::abs(x); });
+                        break;
+                    case Opcode::Exp:
+                        fused_elementwise_map(a, out, count, [](T x) { return std::exp(x); });
+                        break;
+                    case Opcode::Log:
+                        fused_elementwise_map(a, out, count, [](T x) { return std::log(x); });
+                        break;
+                    case Opcode::Negative:
+                        fused_elementwise_map(a, out, count, [](T x) { return -x; });
+                        break;
+                    case Opcode::Relu:
+                        fused_elementwise_map(a, out, count, [](T x) { return x > 0 ? x : 0; });
+                        break;
+                    case Opcode::Sigmoid:
+                        fused_elementwise_map(
+                            a, out, count, [](T x) { return 1 / (1 + std::exp(-x)); });
+                        break;
+                    case Opcode::Sqrt:
+                        fused_elementwise_map(a, out, count, [](T x) { return std::sqrt(x); });
+                        break;
+                    case Opcode::Tanh:
+                        fused_elementwise_map(a, out, count, [](T x) { return std::tanh(x); });
+                        break;
+                    case Opcode::Add:
+                        fused_elementwise_map(a, b, out, count, [](T x, T y) { return x + y; });
+                        break;
+                    case Opcode::Divide:
+                        fused_elementwise_map(a, b, out, count, [](T x, T y) { return x / y; });
+                        break;
+                    case Opcode::Maximum:
+                        fused_elementwise_map(
+                            a, b, out, count, [](T x, T y) { return x > y ? x : y; });
+                        break;
+                    case Opcode::Minimum:
+                        fused_elementwise_map(
+                            a, b, out, count, [](T x, T y) { return x < y ? x : y; });
+                        break;
+                    case Opcode::Multiply:
+                        fused_elementwise_map(a, b, out, count, [](T x, T y) { return x * y; });
+                        break;
+                    case Opcode::Subtract:
+                        fused_elementwise_map(a, b, out, count, [](T x, T y) { return x - y; });
+                        break;
+                    }
+                }
+
+                /// Interprets a FusedElementwise program. The innermost loop axis is cut into
+                /// blocks that are spread over the thread pool; within a block each
+                /// instruction runs as one tight loop over block-sized scratch buffers.
+                template <typename ElementType>
+                void fused_elementwise(
+                    const std::vector<void*>& inputs,
+                    void* output,
+                    const Shape& loop_shape,
+                    const std::vector<Strides>& input_strides,
+                    const std::vector<ngraph::op::FusedElementwise::Instruction>& program)
+                {
+                    // An empty innermost axis would make the block size zero
+                    if (shape_size(loop_shape) == 0)
+                    {
+                        return;
+                    }
+                    const size_t num_inputs = inputs.size();
+                    const size_t num_values = num_inputs + program.size();
+                    const size_t outer_rank = loop_shape.size() - 1;
+                    const size_t inner = loop_shape.back();
+                    const size_t block = std::min(inner, fused_elementwise_block);
+                    const size_t blocks_per_row = (inner + block - 1) / block;
+                    size_t rows = 1;
+                    for (size_t d = 0; d < outer_rank; d++)
+                    {
+                        rows *= loop_shape[d];
+                    }
+
+                    auto run_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<ElementType> scratch(num_values * block);
+                        std::vector<const ElementType*> values(num_values);
+                        for (size_t k = 0; k < program.size(); k++)
+                        {
+                            values[num_inputs + k] = &scratch[(num_inputs + k) * block];
+                        }
+
+                        for (Eigen::Index b = first; b < last; b++)
+                        {
+                            size_t row = b / blocks_per_row;
+                            size_t begin = (b % blocks_per_row) * block;
+                            size_t count = std::min(block, inner - begin);
+
+                            for (size_t i = 0; i < num_inputs; i++)
+                            {
+                                // Offset of this row in input i
+                                size_t offset = 0;
+                                size_t rest = row;
+                                for (size_t d = outer_rank; d-- > 0;)
+                                {
+                                    offset += (rest % loop_shape[d]) * input_strides[i][d];
+                                    rest /= loop_shape[d];
+                                }
+                                auto input = static_cast<const ElementType*>(inputs[i]) + offset;
+                                if (input_strides[i].back() == 0)
+                                {
+                                    // Broadcast along the row
+                                    ElementType* splat = &scratch[i * block];
+                                    std::fill(splat, splat + count, *input);
+                                    values[i] = splat;
+                                }
+                                else
+                                {
+                                    values[i] = input + begin;
+                                }
+                            }
+
+                            for (size_t k = 0; k < program.size(); k++)
+                            {
+                                ElementType* out =
+                                    k + 1 == program.size()
+                                        ? static_cast<ElementType*>(output) + row * inner + begin
+                                        : &scratch[(num_inputs + k) * block];
+                                fused_elementwise_instruction(
+                                    program[k], values.data(), out, count);
+                            }
+                        }
+                    };
+
+                    // Every instruction of the program is an elementwise kernel
+                    if (!eigen::use_thread_pool(eigen::KernelClass::Elementwise,
+                                                rows * inner * program.size()))
+                    {
+                        run_blocks(0, rows * blocks_per_row);
+                        return;
+                    }
+                    Eigen::TensorOpCost cost(
+                        num_inputs * block * sizeof(ElementType),
+                        block * sizeof(ElementType),
+                        program.size() * block);
+                    eigen::get_thread_pool_device().parallelFor(
+                        rows * blocks_per_row, cost, run_blocks);
+                }
+            }
+        }
+    }
+}
@@ -53,7 +53,10 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(input,
                                                                                            in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in.pad(padding, pad_value);
+                    eigen::evaluate(eigen::KernelClass::Movement,
+                                    shape_size(output_shape),
+                                    out,
+                                    in.pad(padding, pad_value));
                 }
             }
         }
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ngraph/runtime/reference/dequantize.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename OutputElementType>
+                void quantize(
+                    void* input, void* output, size_t count, float scale, int64_t zero_point)
+                {
+                    reference::quantize<float, OutputElementType>(
+                        static_cast<const float*>(input),
+                        static_cast<OutputElementType*>(output),
+                        count,
+                        scale,
+                        zero_point);
+                }
+
+                template <typename InputElementType>
+                void dequantize(
+                    void* input, void* output, size_t count, float scale, int64_t zero_point)
+                {
+                    reference::dequantize<InputElementType, float>(
+                        static_cast<const InputElementType*>(input),
+                        static_cast<float*>(output),
+                        count,
+                        scale,
+                        zero_point);
+                }
+            }
+        }
+    }
+}
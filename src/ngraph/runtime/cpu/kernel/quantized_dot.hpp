@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <Eigen/Core>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename OutputElementType>
+                OutputElementType requantize(int32_t acc, float scale)
+                {
+                    const float lowest =
+                        static_cast<float>(std::numeric_limits<OutputElementType>::lowest());
+                    const float highest =
+                        static_cast<float>(std::numeric_limits<OutputElementType>::max());
+                    float value = std::nearbyint(acc * scale);
+                    return static_cast<OutputElementType>(
+                        std::min(std::max(value, lowest), highest));
+                }
+
+                template <>
+                inline float requantize<float>(int32_t acc, float scale)
+                {
+                    return acc * scale;
+                }
+
+                template <>
+                inline int32_t requantize<int32_t>(int32_t acc, float scale)
+                {
+                    double value = std::nearbyint(static_cast<double>(acc) * scale);
+                    return static_cast<int32_t>(
+                        std::min(std::max(value, -2147483648.0), 2147483647.0));
+                }
+
+                // [m, k] u8 x [k, n] i8 -> [m, n], accumulated in i32. The operands are widened
+                // to i32 so the product runs through Eigen's blocked GEMM.
+                template <typename OutputElementType>
+                void quantized_dot(void* arg0,
+                                   void* arg1,
+                                   void* out,
+                                   size_t m,
+                                   size_t k,
+                                   size_t n,
+                                   float requantization_scale)
+                {
+                    using RowMajorI32 =
+                        Eigen::Matrix<int32_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+                    Eigen::Map<const Eigen::Matrix<uint8_t,
+                                                   Eigen::Dynamic,
+                                                   Eigen::Dynamic,
+                                                   Eigen::RowMajor>>
+                        a(static_cast<const uint8_t*>(arg0), m, k);
+                    Eigen::Map<const Eigen::Matrix<int8_t,
+                                                   Eigen::Dynamic,
+                                                   Eigen::Dynamic,
+                                                   Eigen::RowMajor>>
+                        b(static_cast<const int8_t*>(arg1), k, n);
+
+                    RowMajorI32 acc = a.cast<int32_t>() * b.cast<int32_t>();
+
+                    OutputElementType* result = static_cast<OutputElementType*>(out);
+                    const int32_t* acc_data = acc.data();
+                    for (size_t i = 0; i < m * n; i++)
+                    {
+                        result[i] =
+                            requantize<OutputElementType>(acc_data[i], requantization_scale);
+                    }
+                }
+            }
+        }
+    }
+}
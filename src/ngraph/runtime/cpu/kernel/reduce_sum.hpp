@@ -48,7 +48,8 @@ namespace ngraph
                                                                                          out_dims);
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(input,
                                                                                            in_dims);
-                    out.device(eigen::global_thread_pool_device) = in.sum();
+                    eigen::evaluate(
+                        eigen::KernelClass::Reduction, shape_size(input_shape), out, in.sum());
                 }
 
                 template <typename ElementType, unsigned int Rank, unsigned int ReductionDims>
@@ -83,7 +84,10 @@ namespace ngraph
                         out(output, out_dims);
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(input,
                                                                                            in_dims);
-                    out.device(eigen::global_thread_pool_device) = in.sum(reduction_dims);
+                    eigen::evaluate(eigen::KernelClass::Reduction,
+                                    shape_size(input_shape),
+                                    out,
+                                    in.sum(reduction_dims));
                 }
             }
         }
@@ -58,8 +58,10 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, InRank, Eigen::RowMajor>> in(
                         input, in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
-                        in.shuffle(axis_order).reshape(out_dims);
+                    eigen::evaluate(eigen::KernelClass::Movement,
+                                    shape_size(output_shape),
+                                    out,
+                                    in.shuffle(axis_order).reshape(out_dims));
                 }
             }
         }
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // [rows, cols] logits with the softmax taken over each row. Each row is read
+                // twice, once for its maximum and once for the log-sum-exp and the loss.
+                template <typename T>
+                void softmax_cross_entropy(
+                    const T* logits, const T* labels, T* out, size_t rows, size_t cols)
+                {
+#pragma omp parallel for
+                    for (size_t i = 0; i < rows; i++)
+                    {
+                        const T* x = logits + i * cols;
+                        const T* y = labels + i * cols;
+                        T max_value = x[0];
+                        for (size_t j = 1; j < cols; j++)
+                        {
+                            max_value = x[j] > max_value ? x[j] : max_value;
+                        }
+                        T sum = 0;
+                        T label_sum = 0;
+                        T dot = 0;
+                        for (size_t j = 0; j < cols; j++)
+                        {
+                            T shifted = x[j] - max_value;
+                            sum += std::exp(shifted);
+                            label_sum += y[j];
+                            dot += y[j] * shifted;
+                        }
+                        out[i] = label_sum * std::log(sum) - dot;
+                    }
+                }
+
+                // The softmax is staged in the output row, which is rewritten in place as
+                // delta * (softmax * sum(labels) - labels)
+                template <typename T>
+                void softmax_cross_entropy_backprop(const T* logits,
+                                                    const T* labels,
+                                                    const T* delta,
+                                                    T* out,
+                                                    size_t rows,
+                                                    size_t cols)
+                {
+#pragma omp parallel for
+                    for (size_t i = 0; i < rows; i++)
+                    {
+                        const T* x = logits + i * cols;
+                        const T* y = labels + i * cols;
+                        T* z = out + i * cols;
+                        T max_value = x[0];
+                        for (size_t j = 1; j < cols; j++)
+                        {
+                            max_value = x[j] > max_value ? x[j] : max_value;
+                        }
+                        T sum = 0;
+                        T label_sum = 0;
+                        for (size_t j = 0; j < cols; j++)
+                        {
+                            z[j] = std::exp(x[j] - max_value);
+                            sum += z[j];
+                            label_sum += y[j];
+                        }
+                        T scale = delta[i] * label_sum / sum;
+                        for (size_t j = 0; j < cols; j++)
+                        {
+                            z[j] = scale * z[j] - delta[i] * y[j];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_autotuner.hpp"
+
+using namespace ngraph::runtime::cpu;
+
+static const std::vector<std::pair<mkldnn::algorithm, std::string>> s_candidates{
+    {mkldnn::algorithm::convolution_direct, "direct"},
+    {mkldnn::algorithm::convolution_winograd, "winograd"}};
+
+static std::string read_cpu_model()
+{
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0)
+        {
+            auto colon = line.find(':');
+            if (colon != std::string::npos)
+            {
+                auto begin = line.find_first_not_of(' ', colon + 1);
+                return begin == std::string::npos ? "" : line.substr(begin);
+            }
+        }
+    }
+    return "unknown";
+}
+
+static std::string to_hex(const std::string& bytes)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(bytes.size() * 2);
+    for (unsigned char c : bytes)
+    {
+        hex.push_back(digits[c >> 4]);
+        hex.push_back(digits[c & 0xf]);
+    }
+    return hex;
+}
+
+MKLDNNConvolutionAutotuner::MKLDNNConvolutionAutotuner()
+    : m_cpu_model(read_cpu_model())
+{
+}
+
+MKLDNNConvolutionAutotuner& MKLDNNConvolutionAutotuner::get()
+{
+    static MKLDNNConvolutionAutotuner autotuner;
+    return autotuner;
+}
+
+// Each line of the database holds the CPU model, the hex encoded convolution key and the
+// algorithm name, separated by tabs. Decisions made on other CPU models are ignored.
+void MKLDNNConvolutionAutotuner::load(const std::string& path)
+{
+    m_path = path;
+    m_decisions.clear();
+    std::ifstream database(path);
+    std::string line;
+    while (std::getline(database, line))
+    {
+        std::istringstream fields(line);
+        std::string cpu_model, key, name;
+        if (!std::getline(fields, cpu_model, '\t') || !std::getline(fields, key, '\t') ||
+            !std::getline(fields, name) || cpu_model != m_cpu_model)
+        {
+            continue;
+        }
+        for (auto& candidate : s_candidates)
+        {
+            if (candidate.second == name)
+            {
+                m_decisions[key] = candidate.first;
+            }
+        }
+    }
+}
+
+void MKLDNNConvolutionAutotuner::record(const std::string& key, mkldnn::algorithm algorithm)
+{
+    m_decisions[key] = algorithm;
+    for (auto& candidate : s_candidates)
+    {
+        if (candidate.first == algorithm)
+        {
+            std::ofstream database(m_path, std::ios::app);
+            database << m_cpu_model << '\t' << key << '\t' << candidate.second << '\n';
+            if (!database)
+            {
+                NGRAPH_WARN << "Failed to update convolution tuning database " << m_path;
+            }
+        }
+    }
+}
+
+mkldnn::algorithm MKLDNNConvolutionAutotuner::select(const MKLDNNPrimitiveKey& key,
+                                                     const Benchmark& benchmark)
+{
+    const char* path = std::getenv("NGRAPH_CPU_CONV_AUTOTUNE");
+    if (path == nullptr || *path == '\0')
+    {
+        return mkldnn::algorithm::convolution_direct;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_path != path)
+    {
+        load(path);
+    }
+    auto hex_key = to_hex(key.get_key());
+    auto it = m_decisions.find(hex_key);
+    if (it != m_decisions.end())
+    {
+        return it->second;
+    }
+
+    auto best = mkldnn::algorithm::convolution_direct;
+    double best_time = std::numeric_limits<double>::infinity();
+    for (auto& candidate : s_candidates)
+    {
+        double time = benchmark(candidate.first);
+        NGRAPH_DEBUG << "Convolution " << candidate.second << " takes " << time << "s";
+        if (time < best_time)
+        {
+            best = candidate.first;
+            best_time = time;
+        }
+    }
+    record(hex_key, best);
+    return best;
+}
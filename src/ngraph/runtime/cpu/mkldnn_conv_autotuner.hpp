@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Picks the fastest MKLDNN convolution algorithm for each convolution by
+            ///        benchmarking the candidates at compile time.
+            ///
+            /// Autotuning is enabled by setting NGRAPH_CPU_CONV_AUTOTUNE to the path of a
+            /// tuning database. Decisions are keyed by the convolution's descriptors and the
+            /// CPU model, and appended to the database so later compiles on the same machine
+            /// reuse them without benchmarking.
+            class MKLDNNConvolutionAutotuner
+            {
+            public:
+                using Benchmark = std::function<double(mkldnn::algorithm)>;
+
+                static MKLDNNConvolutionAutotuner& get();
+
+                /// \brief Returns the algorithm to use for the convolution identified by key.
+                ///        Without autotuning this is always convolution_direct.
+                /// \param benchmark Returns the time one run of the convolution takes with the
+                ///        given algorithm, or infinity if the algorithm is not supported.
+                mkldnn::algorithm select(const MKLDNNPrimitiveKey& key, const Benchmark& benchmark);
+
+            private:
+                MKLDNNConvolutionAutotuner();
+                MKLDNNConvolutionAutotuner(const MKLDNNConvolutionAutotuner&) = delete;
+                MKLDNNConvolutionAutotuner& operator=(const MKLDNNConvolutionAutotuner&) = delete;
+
+                void load(const std::string& path);
+                void record(const std::string& key, mkldnn::algorithm algorithm);
+
+                std::mutex m_mutex;
+                std::string m_cpu_model;
+                std::string m_path;
+                std::unordered_map<std::string, mkldnn::algorithm> m_decisions;
+            };
+        }
+    }
+}
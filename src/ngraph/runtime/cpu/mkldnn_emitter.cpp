@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -21,18 +25,13 @@
 
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_autotuner.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/type/element_type.hpp"
 
 using namespace ngraph::runtime::cpu;
 
-MKLDNNEmitter::~MKLDNNEmitter()
-{
-    for (auto p : m_mkldnn_primitives)
-        delete p;
-}
-
 const std::vector<mkldnn::primitive*>& MKLDNNEmitter::get_mkldnn_primitives() const
 {
     return m_mkldnn_primitives;
@@ -43,12 +42,106 @@ const std::vector<char*>& MKLDNNEmitter::get_mkldnn_workspaces()
     return m_workspace_bufs;
 }
 
+const std::vector<MKLDNNInvocation>& MKLDNNEmitter::get_mkldnn_invocations()
+{
+    if (m_invocations.size() == m_mkldnn_primitives.size())
+    {
+        return m_invocations;
+    }
+
+    m_invocations.assign(m_mkldnn_primitives.size(), MKLDNNInvocation{nullptr, nullptr});
+    // Primitives built against the same memory primitives must also share a lock since
+    // binding one of them rebinds the other
+    std::unordered_map<size_t, std::mutex*> memory_mutexes;
+    for (size_t index = 0; index < m_mkldnn_primitives.size(); index++)
+    {
+        auto deps = m_primitive_deps.find(index);
+        if (deps == m_primitive_deps.end())
+        {
+            continue;
+        }
+        auto memories = m_primitive_memories.find(index);
+        auto& invocation = m_invocations[index];
+        invocation.memories =
+            memories != m_primitive_memories.end() ? &memories->second : &deps->second;
+
+        auto shared = m_shared_primitives.find(index);
+        if (shared != m_shared_primitives.end())
+        {
+            invocation.mutex = &shared->second->mutex;
+            continue;
+        }
+        for (auto memory : *invocation.memories)
+        {
+            auto it = memory_mutexes.find(memory);
+            if (it != memory_mutexes.end())
+            {
+                invocation.mutex = it->second;
+                break;
+            }
+        }
+        if (!invocation.mutex)
+        {
+            m_primitive_mutexes.emplace_back(new std::mutex);
+            invocation.mutex = m_primitive_mutexes.back().get();
+        }
+        for (auto memory : *invocation.memories)
+        {
+            memory_mutexes[memory] = invocation.mutex;
+        }
+    }
+    return m_invocations;
+}
+
 size_t MKLDNNEmitter::insert_primitive(mkldnn::primitive* primitive)
 {
     m_mkldnn_primitives.emplace_back(primitive);
+    m_owned_primitives.emplace_back(primitive);
     return (m_mkldnn_primitives.size() - 1);
 }
 
+size_t MKLDNNEmitter::insert_shared_primitive(mkldnn::primitive* primitive)
+{
+    m_mkldnn_primitives.emplace_back(primitive);
+    m_owned_primitives.emplace_back(nullptr);
+    return (m_mkldnn_primitives.size() - 1);
+}
+
+bool MKLDNNEmitter::find_primitive(const MKLDNNPrimitiveKey& key, size_t& index)
+{
+    MKLDNNPrimitiveKey scoped_key(key);
+    scoped_key << m_cache_scope;
+    auto shared = MKLDNNPrimitiveCache::get().find(scoped_key);
+    if (!shared)
+    {
+        return false;
+    }
+
+    std::vector<size_t> deps;
+    for (size_t i = 0; i + 1 < shared->primitives.size(); i++)
+    {
+        deps.push_back(insert_shared_primitive(shared->primitives[i].get()));
+    }
+    index = insert_shared_primitive(shared->primitives.back().get());
+    m_primitive_deps[index] = deps;
+    m_shared_primitives[index] = shared;
+    return true;
+}
+
+void MKLDNNEmitter::share_primitive(const MKLDNNPrimitiveKey& key, size_t index)
+{
+    auto shared = std::make_shared<MKLDNNSharedPrimitive>();
+    for (auto dep : m_primitive_deps.at(index))
+    {
+        shared->primitives.push_back(std::move(m_owned_primitives[dep]));
+    }
+    shared->primitives.push_back(std::move(m_owned_primitives[index]));
+    m_shared_primitives[index] = shared;
+    MKLDNNPrimitiveKey scoped_key(key);
+    scoped_key << m_cache_scope;
+    MKLDNNPrimitiveCache::get().insert(scoped_key, shared);
+}
+
 size_t MKLDNNEmitter::insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace)
 {
     m_workspace_bufs.push_back(workspace.get()->buf);
@@ -159,6 +252,58 @@ std::pair<size_t, size_t> MKLDNNEmitter::build_group_convolution_forward(
     return std::make_pair(reorder_index, conv_index);
 }
 
+// Best of several runs of primitive on scratch buffers
+static double time_primitive(const mkldnn::primitive& primitive)
+{
+    const size_t iterations = 5;
+    double best = std::numeric_limits<double>::infinity();
+    // The first run warms up caches and lazily initialized kernels
+    for (size_t i = 0; i <= iterations; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        mkldnn::stream(mkldnn::stream::kind::eager).submit({primitive}).wait();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (i > 0)
+        {
+            best = std::min(best, elapsed.count());
+        }
+    }
+    return best;
+}
+
+static mkldnn::memory build_scratch_memory(const mkldnn::memory::primitive_desc& pd)
+{
+    mkldnn::memory memory(pd);
+    std::memset(memory.get_data_handle(), 0, pd.get_size());
+    return memory;
+}
+
+// Time one run of a convolution, or infinity if MKLDNN cannot create it
+static double benchmark_convolution_forward(const mkldnn::convolution_forward::desc& desc,
+                                            const mkldnn::primitive_attr& attr,
+                                            bool use_bias)
+{
+    try
+    {
+        mkldnn::convolution_forward::primitive_desc pd(
+            desc, attr, mkldnn_utils::global_cpu_engine);
+        auto input = build_scratch_memory(pd.src_primitive_desc());
+        auto weights = build_scratch_memory(pd.weights_primitive_desc());
+        auto result = build_scratch_memory(pd.dst_primitive_desc());
+        if (use_bias)
+        {
+            auto bias = build_scratch_memory(pd.bias_primitive_desc());
+            return time_primitive(mkldnn::convolution_forward(pd, input, weights, bias, result));
+        }
+        return time_primitive(mkldnn::convolution_forward(pd, input, weights, result));
+    }
+    catch (const mkldnn::error&)
+    {
+        // The algorithm does not support this convolution on this machine
+        return std::numeric_limits<double>::infinity();
+    }
+}
+
 size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& input_data_desc,
                                                 const mkldnn::memory::desc& weights_desc,
                                                 const mkldnn::memory::desc& result_desc,
@@ -168,12 +313,139 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
                                                 const ngraph::CoordinateDiff& padding_above,
                                                 const mkldnn::post_ops& pops)
 {
+    mkldnn::primitive_attr conv_attr;
+    conv_attr.set_post_ops(pops);
+
+    auto conv_desc = [&](mkldnn::algorithm algorithm) {
+        return mkldnn::convolution_forward::desc(
+            mkldnn::prop_kind::forward,
+            algorithm,
+            input_data_desc,
+            weights_desc,
+            result_desc,
+            mkldnn::memory::dims(strides.begin(), strides.end()),
+            mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+            mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+            mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+            mkldnn::padding_kind::zero);
+    };
+
+    MKLDNNPrimitiveKey key("convolution_forward");
+    key << input_data_desc << weights_desc << result_desc << strides << dilation_strides
+        << padding_below << padding_above << pops;
+    auto algorithm = MKLDNNConvolutionAutotuner::get().select(
+        key, [&](mkldnn::algorithm candidate) {
+            return benchmark_convolution_forward(conv_desc(candidate), conv_attr, false);
+        });
+    key << algorithm;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
+    size_t input_data_index = build_memory_primitive(input_data_desc);
+    size_t weights_index = build_memory_primitive(weights_desc);
+    size_t result_index = build_memory_primitive(result_desc);
+
+    size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
+        {conv_desc(algorithm), conv_attr, mkldnn_utils::global_cpu_engine},
+        *m_mkldnn_primitives[input_data_index],
+        *m_mkldnn_primitives[weights_index],
+        *m_mkldnn_primitives[result_index]));
+
+    m_primitive_deps[conv_index] = {input_data_index, weights_index, result_index};
+    share_primitive(key, conv_index);
+    return conv_index;
+}
+
+size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& input_data_desc,
+                                                const mkldnn::memory::desc& weights_desc,
+                                                const mkldnn::memory::desc& bias_desc,
+                                                const mkldnn::memory::desc& result_desc,
+                                                const ngraph::Strides& strides,
+                                                const ngraph::Strides& dilation_strides,
+                                                const ngraph::CoordinateDiff& padding_below,
+                                                const ngraph::CoordinateDiff& padding_above,
+                                                const mkldnn::post_ops& pops)
+{
+    mkldnn::primitive_attr conv_attr;
+    conv_attr.set_post_ops(pops);
+
+    auto conv_desc = [&](mkldnn::algorithm algorithm) {
+        return mkldnn::convolution_forward::desc(
+            mkldnn::prop_kind::forward,
+            algorithm,
+            input_data_desc,
+            weights_desc,
+            bias_desc,
+            result_desc,
+            mkldnn::memory::dims(strides.begin(), strides.end()),
+            mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+            mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+            mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+            mkldnn::padding_kind::zero);
+    };
+
+    MKLDNNPrimitiveKey key("convolution_forward_bias");
+    key << input_data_desc << weights_desc << bias_desc << result_desc << strides
+        << dilation_strides << padding_below << padding_above << pops;
+    auto algorithm = MKLDNNConvolutionAutotuner::get().select(
+        key, [&](mkldnn::algorithm candidate) {
+            return benchmark_convolution_forward(conv_desc(candidate), conv_attr, true);
+        });
+    key << algorithm;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
+    const size_t input_data_index = build_memory_primitive(input_data_desc);
+    const size_t weights_index = build_memory_primitive(weights_desc);
+    const size_t bias_index = build_memory_primitive(bias_desc);
+    const size_t result_index = build_memory_primitive(result_desc);
+
+    const size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
+        {conv_desc(algorithm), conv_attr, mkldnn_utils::global_cpu_engine},
+        *m_mkldnn_primitives[input_data_index],
+        *m_mkldnn_primitives[weights_index],
+        *m_mkldnn_primitives[bias_index],
+        *m_mkldnn_primitives[result_index]));
+
+    m_primitive_deps[conv_index] = {input_data_index, weights_index, bias_index, result_index};
+    share_primitive(key, conv_index);
+    return conv_index;
+}
+
+size_t MKLDNNEmitter::build_quantized_convolution_forward(
+    const mkldnn::memory::desc& input_data_desc,
+    const mkldnn::memory::desc& weights_desc,
+    const mkldnn::memory::desc& result_desc,
+    const ngraph::Strides& strides,
+    const ngraph::Strides& dilation_strides,
+    const ngraph::CoordinateDiff& padding_below,
+    const ngraph::CoordinateDiff& padding_above,
+    const float scale,
+    const mkldnn::post_ops& pops)
+{
+    MKLDNNPrimitiveKey key("quantized_convolution_forward");
+    key << input_data_desc << weights_desc << result_desc << strides << dilation_strides
+        << padding_below << padding_above << scale << pops;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_data_index = build_memory_primitive(input_data_desc);
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
     mkldnn::primitive_attr conv_attr;
     conv_attr.set_post_ops(pops);
+    conv_attr.set_int_output_round_mode(mkldnn::round_mode::round_nearest);
+    conv_attr.set_output_scales(0, {scale});
 
     size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
         {{mkldnn::prop_kind::forward,
@@ -193,19 +465,31 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[conv_index] = {input_data_index, weights_index, result_index};
+    share_primitive(key, conv_index);
     return conv_index;
 }
 
-size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& input_data_desc,
-                                                const mkldnn::memory::desc& weights_desc,
-                                                const mkldnn::memory::desc& bias_desc,
-                                                const mkldnn::memory::desc& result_desc,
-                                                const ngraph::Strides& strides,
-                                                const ngraph::Strides& dilation_strides,
-                                                const ngraph::CoordinateDiff& padding_below,
-                                                const ngraph::CoordinateDiff& padding_above,
-                                                const mkldnn::post_ops& pops)
+size_t MKLDNNEmitter::build_quantized_convolution_forward(
+    const mkldnn::memory::desc& input_data_desc,
+    const mkldnn::memory::desc& weights_desc,
+    const mkldnn::memory::desc& bias_desc,
+    const mkldnn::memory::desc& result_desc,
+    const ngraph::Strides& strides,
+    const ngraph::Strides& dilation_strides,
+    const ngraph::CoordinateDiff& padding_below,
+    const ngraph::CoordinateDiff& padding_above,
+    const float scale,
+    const mkldnn::post_ops& pops)
 {
+    MKLDNNPrimitiveKey key("quantized_convolution_forward_bias");
+    key << input_data_desc << weights_desc << bias_desc << result_desc << strides
+        << dilation_strides << padding_below << padding_above << scale << pops;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     const size_t input_data_index = build_memory_primitive(input_data_desc);
     const size_t weights_index = build_memory_primitive(weights_desc);
     const size_t bias_index = build_memory_primitive(bias_desc);
@@ -213,6 +497,8 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
 
     mkldnn::primitive_attr conv_attr;
     conv_attr.set_post_ops(pops);
+    conv_attr.set_int_output_round_mode(mkldnn::round_mode::round_nearest);
+    conv_attr.set_output_scales(0, {scale});
 
     const size_t conv_index = insert_primitive(new mkldnn::convolution_forward(
         {{mkldnn::prop_kind::forward,
@@ -234,6 +520,7 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[conv_index] = {input_data_index, weights_index, bias_index, result_index};
+    share_primitive(key, conv_index);
     return conv_index;
 }
 
@@ -247,6 +534,15 @@ size_t MKLDNNEmitter::build_convolution_backward_weights_bias(
     const ngraph::CoordinateDiff& ng_padding_below,
     const ngraph::CoordinateDiff& ng_padding_above)
 {
+    MKLDNNPrimitiveKey key("convolution_backward_weights_bias");
+    key << in_data_desc << in_delta_desc << out_weights_delta_desc << out_bias_delta_desc
+        << ng_strides << ng_dilation_strides << ng_padding_below << ng_padding_above;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     const size_t in_data_index = build_memory_primitive(in_data_desc);
     const size_t in_delta_index = build_memory_primitive(in_delta_desc);
     const size_t out_weights_delta_index = build_memory_primitive(out_weights_delta_desc);
@@ -292,6 +588,7 @@ size_t MKLDNNEmitter::build_convolution_backward_weights_bias(
 
     m_primitive_deps[conv_index] = {
         in_data_index, in_delta_index, out_weights_delta_index, out_bias_delta_index};
+    share_primitive(key, conv_index);
     return conv_index;
 }
 
@@ -304,6 +601,15 @@ size_t
                                                       const ngraph::CoordinateDiff& padding_below,
                                                       const ngraph::CoordinateDiff& padding_above)
 {
+    MKLDNNPrimitiveKey key("convolution_backward_weights");
+    key << input_desc << delta_desc << result_desc << strides << dilation_strides << padding_below
+        << padding_above;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -336,6 +642,7 @@ size_t
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, delta_index, result_index};
+    share_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -347,6 +654,15 @@ size_t MKLDNNEmitter::build_convolution_backward_data(const mkldnn::memory::desc
                                                       const ngraph::CoordinateDiff& padding_below,
                                                       const ngraph::CoordinateDiff& padding_above)
 {
+    MKLDNNPrimitiveKey key("convolution_backward_data");
+    key << weights_desc << delta_desc << result_desc << strides << dilation_strides
+        << padding_below << padding_above;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t delta_index = build_memory_primitive(delta_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -379,6 +695,7 @@ size_t MKLDNNEmitter::build_convolution_backward_data(const mkldnn::memory::desc
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {weights_index, delta_index, result_index};
+    share_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -390,6 +707,15 @@ size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
                                             const ngraph::Shape& padding_below,
                                             const ngraph::Shape& padding_above)
 {
+    MKLDNNPrimitiveKey key("pooling_forward");
+    key << pooling_algorithm << input_desc << result_desc << window_strides << window_shape
+        << padding_below << padding_above;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -408,6 +734,7 @@ size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    share_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -419,6 +746,15 @@ size_t MKLDNNEmitter::build_pooling_backward(mkldnn::algorithm pooling_algorithm
                                              const ngraph::Shape& padding_below,
                                              const ngraph::Shape& padding_above)
 {
+    MKLDNNPrimitiveKey key("pooling_backward");
+    key << pooling_algorithm << diff_dst_desc << diff_src_desc << window_strides << window_shape
+        << padding_below << padding_above;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(diff_dst_desc);
     size_t result_index = build_memory_primitive(diff_src_desc);
 
@@ -446,6 +782,7 @@ size_t MKLDNNEmitter::build_pooling_backward(mkldnn::algorithm pooling_algorithm
         *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    share_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -507,6 +844,9 @@ size_t MKLDNNEmitter::build_max_pooling_backward(mkldnn::algorithm pooling_algor
         fprop_src_index, diff_src_index, ws_index, ws_buf_index};
     m_primitive_deps[bwd_primitive_index] = {
         diff_dst_index, ws_index, diff_src_index, ws_buf_index};
+    // The trailing workspace buffer index is not a memory primitive
+    m_primitive_memories[fwd_primitive_index] = {fprop_src_index, diff_src_index, ws_index};
+    m_primitive_memories[bwd_primitive_index] = {diff_dst_index, ws_index, diff_src_index};
     return bwd_primitive_index;
 }
 
@@ -518,6 +858,15 @@ size_t MKLDNNEmitter::build_max_pooling_with_indices_forward(mkldnn::algorithm p
                                                              const ngraph::Shape& padding_below,
                                                              const ngraph::Shape& padding_above)
 {
+    MKLDNNPrimitiveKey key("max_pooling_with_indices_forward");
+    key << pooling_algorithm << src_desc << dst_desc << window_strides << window_shape
+        << padding_below << padding_above;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t src_index = build_memory_primitive(src_desc);
     size_t dst_index = build_memory_primitive(dst_desc);
 
@@ -542,6 +891,7 @@ size_t MKLDNNEmitter::build_max_pooling_with_indices_forward(mkldnn::algorithm p
                                                      *m_mkldnn_primitives[ws_index]));
 
     m_primitive_deps[fwd_primitive_index] = {src_index, dst_index, ws_index};
+    share_primitive(key, fwd_primitive_index);
     return fwd_primitive_index;
 }
 
@@ -554,6 +904,15 @@ size_t MKLDNNEmitter::build_max_pooling_with_indices_backward(
     const ngraph::Shape& padding_below,
     const ngraph::Shape& padding_above)
 {
+    MKLDNNPrimitiveKey key("max_pooling_with_indices_backward");
+    key << pooling_algorithm << diff_dst_desc << diff_src_desc << window_strides << window_shape
+        << padding_below << padding_above;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t diff_dst_index = build_memory_primitive(diff_dst_desc);
     size_t diff_src_index = build_memory_primitive(diff_src_desc);
 
@@ -587,12 +946,21 @@ size_t MKLDNNEmitter::build_max_pooling_with_indices_backward(
         *m_mkldnn_primitives[diff_src_index]));
 
     m_primitive_deps[bwd_primitive_index] = {diff_dst_index, fprop_ws_index, diff_src_index};
+    share_primitive(key, bwd_primitive_index);
     return bwd_primitive_index;
 }
 
 size_t MKLDNNEmitter::build_reorder(const mkldnn::memory::desc& input_desc,
                                     const mkldnn::memory::desc& result_desc)
 {
+    MKLDNNPrimitiveKey key("reorder");
+    key << input_desc << result_desc;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t result_index = build_memory_primitive(result_desc);
 
@@ -600,6 +968,7 @@ size_t MKLDNNEmitter::build_reorder(const mkldnn::memory::desc& input_desc,
         new mkldnn::reorder(*m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]));
 
     m_primitive_deps[primitive_index] = {input_index, result_index};
+    share_primitive(key, primitive_index);
     return primitive_index;
 }
 
@@ -724,6 +1093,15 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
                                               bool bn_training_flag,
                                               const mkldnn::post_ops& pops)
 {
+    MKLDNNPrimitiveKey key("batchnorm_forward");
+    key << input_desc << weights_desc << result_desc << mean_desc << variance_desc << eps
+        << use_global_stats << bn_training_flag << pops;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t input_index = build_memory_primitive(input_desc);
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t result_index = build_memory_primitive(result_desc);
@@ -750,6 +1128,7 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
 
         m_primitive_deps[batchnorm_index] = {
             input_index, weights_index, result_index, mean_index, variance_index};
+        share_primitive(key, batchnorm_index);
         return batchnorm_index;
     }
     else
@@ -770,6 +1149,7 @@ size_t MKLDNNEmitter::build_batchnorm_forward(const mkldnn::memory::desc& input_
 
         m_primitive_deps[batchnorm_index] = {
             input_index, mean_index, variance_index, weights_index, result_index};
+        share_primitive(key, batchnorm_index);
         return batchnorm_index;
     }
 }
@@ -783,6 +1163,15 @@ size_t MKLDNNEmitter::build_batchnorm_backward(const mkldnn::memory::desc& weigh
                                                const mkldnn::memory::desc& dweights_desc,
                                                const double eps)
 {
+    MKLDNNPrimitiveKey key("batchnorm_backward");
+    key << weights_desc << input_desc << mean_desc << variance_desc << delta_desc << dinput_desc
+        << dweights_desc << eps;
+    size_t cached_index;
+    if (find_primitive(key, cached_index))
+    {
+        return cached_index;
+    }
+
     size_t weights_index = build_memory_primitive(weights_desc);
     size_t input_index = build_memory_primitive(input_desc);
     size_t mean_index = build_memory_primitive(mean_desc);
@@ -818,6 +1207,7 @@ size_t MKLDNNEmitter::build_batchnorm_backward(const mkldnn::memory::desc& weigh
                                          delta_index,
                                          dinput_index,
                                          dweights_index};
+    share_primitive(key, batchnorm_index);
     return batchnorm_index;
 }
 
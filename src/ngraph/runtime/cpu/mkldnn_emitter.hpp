@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -24,6 +25,7 @@
 #include <mkldnn.hpp>
 
 #include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -48,12 +50,20 @@ namespace ngraph
             class MKLDNNEmitter
             {
             public:
-                MKLDNNEmitter() {}
-                ~MKLDNNEmitter();
-
+                /// \param cache_scope Primitives are only shared through the process-wide
+                ///        cache with emitters of the same scope.
+                MKLDNNEmitter(size_t cache_scope = 0)
+                    : m_cache_scope(cache_scope)
+                {
+                }
                 const std::vector<mkldnn::primitive*>& get_mkldnn_primitives() const;
                 const std::vector<char*>& get_mkldnn_workspaces();
 
+                /// \brief Returns the lock and bound memories of every compute primitive,
+                ///        indexed like get_mkldnn_primitives(). Must be called once all
+                ///        primitives have been built.
+                const std::vector<MKLDNNInvocation>& get_mkldnn_invocations();
+
                 size_t insert_primitive(mkldnn::primitive* primitive);
                 size_t insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace);
                 const std::vector<size_t>& get_primitive_deps(size_t index) const;
@@ -90,6 +100,35 @@ namespace ngraph
                                                  const ngraph::CoordinateDiff& padding_above,
                                                  const mkldnn::post_ops& pops = mkldnn::post_ops());
 
+                /**
+                 * Int8 convolution with the i32 accumulator requantized by scale
+                 */
+                size_t build_quantized_convolution_forward(
+                    const mkldnn::memory::desc& input_data_desc,
+                    const mkldnn::memory::desc& weights_desc,
+                    const mkldnn::memory::desc& result_desc,
+                    const ngraph::Strides& strides,
+                    const ngraph::Strides& dilation_strides,
+                    const ngraph::CoordinateDiff& padding_below,
+                    const ngraph::CoordinateDiff& padding_above,
+                    const float scale,
+                    const mkldnn::post_ops& pops = mkldnn::post_ops());
+
+                /**
+                 * Int8 convolution + i32 bias with the accumulator requantized by scale
+                 */
+                size_t build_quantized_convolution_forward(
+                    const mkldnn::memory::desc& input_data_desc,
+                    const mkldnn::memory::desc& weights_desc,
+                    const mkldnn::memory::desc& bias_desc,
+                    const mkldnn::memory::desc& result_desc,
+                    const ngraph::Strides& strides,
+                    const ngraph::Strides& dilation_strides,
+                    const ngraph::CoordinateDiff& padding_below,
+                    const ngraph::CoordinateDiff& padding_above,
+                    const float scale,
+                    const mkldnn::post_ops& pops = mkldnn::post_ops());
+
                 mkldnn::memory::format query_convolution_forward_weight_format(
                     const mkldnn::memory::desc& input_data_desc,
                     const mkldnn::memory::desc& weights_desc_any,
@@ -236,7 +275,25 @@ namespace ngraph
                                     const size_t concat_dim);
 
             private:
+                // Looks up a primitive built by any emitter in the process. On a hit the
+                // shared memory and compute primitives are inserted here and index is set to
+                // the compute primitive.
+                bool find_primitive(const MKLDNNPrimitiveKey& key, size_t& index);
+                // Hands the compute primitive at index and its memory primitives over to the
+                // process-wide cache
+                void share_primitive(const MKLDNNPrimitiveKey& key, size_t index);
+                size_t insert_shared_primitive(mkldnn::primitive* primitive);
+
+                size_t m_cache_scope;
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
+                // Null for primitives owned by the process-wide cache
+                std::vector<std::unique_ptr<mkldnn::primitive>> m_owned_primitives;
+                std::unordered_map<size_t, std::shared_ptr<MKLDNNSharedPrimitive>>
+                    m_shared_primitives;
+                // Memories bound at invocation when they differ from the primitive deps
+                std::unordered_map<size_t, std::vector<size_t>> m_primitive_memories;
+                std::vector<std::unique_ptr<std::mutex>> m_primitive_mutexes;
+                std::vector<MKLDNNInvocation> m_invocations;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
                 std::unordered_map<size_t, std::vector<size_t>> m_primitive_deps;
                 std::vector<std::unique_ptr<MKLDNNWorkspace>> m_workspaces;
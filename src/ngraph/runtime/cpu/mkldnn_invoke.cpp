@@ -14,12 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <mutex>
 #include <string>
 
 #include <mkldnn.hpp>
 
 #include "mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
 mkldnn::engine ngraph::runtime::cpu::mkldnn_utils::global_cpu_engine(mkldnn::engine::cpu, 0);
@@ -28,13 +30,22 @@ extern "C" void ngraph::runtime::cpu::mkldnn_utils::set_memory_ptr(CPURuntimeCon
                                                                    size_t primitive_index,
                                                                    void* ptr)
 {
-    auto primitive = static_cast<mkldnn::memory*>(ctx->mkldnn_primitives[primitive_index]);
-    primitive->set_data_handle(ptr);
+    ctx->mkldnn_bindings[primitive_index] = ptr;
 }
 
 extern "C" void ngraph::runtime::cpu::mkldnn_utils::mkldnn_invoke_primitive(CPURuntimeContext* ctx,
                                                                             size_t primitive_index)
 {
+    const auto& invocation = ctx->mkldnn_invocations[primitive_index];
+    std::lock_guard<std::mutex> lock(*invocation.mutex);
+    for (auto memory_index : *invocation.memories)
+    {
+        if (void* ptr = ctx->mkldnn_bindings[memory_index])
+        {
+            static_cast<mkldnn::memory*>(ctx->mkldnn_primitives[memory_index])
+                ->set_data_handle(ptr);
+        }
+    }
     mkldnn::stream s(mkldnn::stream::kind::eager);
     s.submit({*ctx->mkldnn_primitives[primitive_index]}).wait();
 }
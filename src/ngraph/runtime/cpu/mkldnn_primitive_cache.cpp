@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+using namespace ngraph::runtime::cpu;
+
+MKLDNNPrimitiveKey::MKLDNNPrimitiveKey(const std::string& kind)
+    : m_key(kind)
+{
+    m_key.push_back('\0');
+}
+
+void MKLDNNPrimitiveKey::append(const void* data, size_t size)
+{
+    m_key.append(reinterpret_cast<const char*>(data), size);
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(const mkldnn::memory::desc& desc)
+{
+    // Only the initialized fields of the C descriptor are hashed; the rest of the struct
+    // (including padding) is not guaranteed to be zeroed
+    const mkldnn_memory_desc_t& md = desc.data;
+    append(&md.ndims, sizeof(md.ndims));
+    append(md.dims, md.ndims * sizeof(md.dims[0]));
+    append(&md.data_type, sizeof(md.data_type));
+    append(&md.format, sizeof(md.format));
+    if (md.format == mkldnn_blocked)
+    {
+        const mkldnn_blocking_desc_t& blk = md.layout_desc.blocking;
+        append(blk.block_dims, md.ndims * sizeof(blk.block_dims[0]));
+        append(blk.strides[0], md.ndims * sizeof(blk.strides[0][0]));
+        append(blk.strides[1], md.ndims * sizeof(blk.strides[1][0]));
+        append(blk.padding_dims, md.ndims * sizeof(blk.padding_dims[0]));
+        append(blk.offset_padding_to_data, md.ndims * sizeof(blk.offset_padding_to_data[0]));
+        append(&blk.offset_padding, sizeof(blk.offset_padding));
+    }
+    return *this;
+}
+
+MKLDNNPrimitiveKey&
+    MKLDNNPrimitiveKey::operator<<(const std::vector<mkldnn::memory::desc>& descs)
+{
+    size_t count = descs.size();
+    append(&count, sizeof(count));
+    for (auto& desc : descs)
+    {
+        *this << desc;
+    }
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(const mkldnn::post_ops& pops)
+{
+    int count = pops.len();
+    append(&count, sizeof(count));
+    for (int i = 0; i < count; i++)
+    {
+        auto kind = pops.kind(i);
+        append(&kind, sizeof(kind));
+        if (kind == mkldnn::primitive::kind::sum)
+        {
+            float scale;
+            pops.get_params_sum(i, scale);
+            *this << scale;
+        }
+        else if (kind == mkldnn::primitive::kind::eltwise)
+        {
+            float scale, alpha, beta;
+            mkldnn::algorithm algorithm;
+            pops.get_params_eltwise(i, scale, algorithm, alpha, beta);
+            *this << scale << algorithm << alpha << beta;
+        }
+    }
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(mkldnn::algorithm algorithm)
+{
+    append(&algorithm, sizeof(algorithm));
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(const ngraph::Strides& strides)
+{
+    size_t count = strides.size();
+    append(&count, sizeof(count));
+    append(strides.data(), count * sizeof(size_t));
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(const ngraph::Shape& shape)
+{
+    size_t count = shape.size();
+    append(&count, sizeof(count));
+    append(shape.data(), count * sizeof(size_t));
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(const ngraph::CoordinateDiff& diff)
+{
+    size_t count = diff.size();
+    append(&count, sizeof(count));
+    append(diff.data(), count * sizeof(std::ptrdiff_t));
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(float value)
+{
+    append(&value, sizeof(value));
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(double value)
+{
+    append(&value, sizeof(value));
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(bool value)
+{
+    m_key.push_back(value ? '\1' : '\0');
+    return *this;
+}
+
+MKLDNNPrimitiveKey& MKLDNNPrimitiveKey::operator<<(size_t value)
+{
+    append(&value, sizeof(value));
+    return *this;
+}
+
+MKLDNNPrimitiveCache& MKLDNNPrimitiveCache::get()
+{
+    static MKLDNNPrimitiveCache cache;
+    return cache;
+}
+
+std::shared_ptr<MKLDNNSharedPrimitive> MKLDNNPrimitiveCache::find(const MKLDNNPrimitiveKey& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_cache.find(key.get_key());
+    if (it == m_cache.end())
+    {
+        return nullptr;
+    }
+    auto primitive = it->second.lock();
+    if (!primitive)
+    {
+        m_cache.erase(it);
+    }
+    return primitive;
+}
+
+void MKLDNNPrimitiveCache::insert(const MKLDNNPrimitiveKey& key,
+                                  const std::shared_ptr<MKLDNNSharedPrimitive>& primitive)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache[key.get_key()] = primitive;
+}
+
+size_t MKLDNNPrimitiveCache::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (auto it = m_cache.begin(); it != m_cache.end();)
+    {
+        if (it->second.expired())
+        {
+            it = m_cache.erase(it);
+        }
+        else
+        {
+            count++;
+            it++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Identifies an MKLDNN primitive by its kind, memory descriptors and
+            ///        attributes. Two builders that stream the same values into a key would
+            ///        create interchangeable primitives.
+            class MKLDNNPrimitiveKey
+            {
+            public:
+                MKLDNNPrimitiveKey(const std::string& kind);
+
+                MKLDNNPrimitiveKey& operator<<(const mkldnn::memory::desc& desc);
+                MKLDNNPrimitiveKey& operator<<(const std::vector<mkldnn::memory::desc>& descs);
+                MKLDNNPrimitiveKey& operator<<(const mkldnn::post_ops& pops);
+                MKLDNNPrimitiveKey& operator<<(mkldnn::algorithm algorithm);
+                MKLDNNPrimitiveKey& operator<<(const ngraph::Strides& strides);
+                MKLDNNPrimitiveKey& operator<<(const ngraph::Shape& shape);
+                MKLDNNPrimitiveKey& operator<<(const ngraph::CoordinateDiff& diff);
+                MKLDNNPrimitiveKey& operator<<(float value);
+                MKLDNNPrimitiveKey& operator<<(double value);
+                MKLDNNPrimitiveKey& operator<<(bool value);
+                MKLDNNPrimitiveKey& operator<<(size_t value);
+
+                const std::string& get_key() const { return m_key; }
+            private:
+                void append(const void* data, size_t size);
+
+                std::string m_key;
+            };
+
+            /// \brief A compute primitive together with the memory primitives it was created
+            ///        against. The memory primitives are stored in the order of the compute
+            ///        primitive's dependencies and the compute primitive comes last.
+            ///        Since the data handles of the memory primitives are rebound on every
+            ///        invocation, \p mutex must be held from binding to completion.
+            struct MKLDNNSharedPrimitive
+            {
+                std::vector<std::unique_ptr<mkldnn::primitive>> primitives;
+                std::mutex mutex;
+            };
+
+            /// \brief Per-primitive invocation data handed to the runtime context. \p mutex
+            ///        guards the primitive and \p memories lists the memory primitive indices
+            ///        whose data handles are bound by set_memory_ptr.
+            struct MKLDNNInvocation
+            {
+                std::mutex* mutex;
+                const std::vector<size_t>* memories;
+            };
+
+            /// \brief Process-wide cache of MKLDNN primitives shared across compiled functions.
+            ///        Entries are held weakly and go away once the last function using them is
+            ///        destroyed.
+            class MKLDNNPrimitiveCache
+            {
+            public:
+                static MKLDNNPrimitiveCache& get();
+
+                std::shared_ptr<MKLDNNSharedPrimitive> find(const MKLDNNPrimitiveKey& key);
+                void insert(const MKLDNNPrimitiveKey& key,
+                            const std::shared_ptr<MKLDNNSharedPrimitive>& primitive);
+
+                /// \brief Number of live cached primitives.
+                size_t size();
+
+            private:
+                MKLDNNPrimitiveCache() {}
+                MKLDNNPrimitiveCache(const MKLDNNPrimitiveCache&) = delete;
+                MKLDNNPrimitiveCache& operator=(const MKLDNNPrimitiveCache&) = delete;
+
+                std::mutex m_mutex;
+                std::unordered_map<std::string, std::weak_ptr<MKLDNNSharedPrimitive>> m_cache;
+            };
+        }
+    }
+}
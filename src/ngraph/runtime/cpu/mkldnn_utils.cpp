@@ -60,8 +60,12 @@ static const std::unordered_set<std::type_index> s_op_registry{
     TI(ngraph::op::ReluBackprop)};
 
 // Mapping from POD types to MKLDNN data types
+// The MKLDNN release we build against has no half precision data types, so f16 and bf16
+// tensors are computed in f32 (see CPUReducedPrecisionLowering)
 static const std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_data_type_map{
     {element::boolean, mkldnn::memory::data_type::s8},
+    {element::f16, mkldnn::memory::data_type::data_undef},
+    {element::bf16, mkldnn::memory::data_type::data_undef},
     {element::f32, mkldnn::memory::data_type::f32},
     {element::f64, mkldnn::memory::data_type::data_undef},
     {element::i8, mkldnn::memory::data_type::s8},
@@ -75,6 +79,8 @@ static const std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_d
 
 static const std::map<element::Type, const std::string> s_mkldnn_data_type_string_map{
     {element::boolean, "mkldnn::memory::data_type::s8"},
+    {element::f16, "mkldnn::memory::data_type::data_undef"},
+    {element::bf16, "mkldnn::memory::data_type::data_undef"},
     {element::f32, "mkldnn::memory::data_type::f32"},
     {element::f64, "mkldnn::memory::data_type::data_undef"},
     {element::i8, "mkldnn::memory::data_type::s8"},
@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "conv_bias_epilogue.hpp"
+
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static NodeVector epilogue_args(const shared_ptr<Node>& data_batch,
+                                const shared_ptr<Node>& filters,
+                                const shared_ptr<Node>& bias,
+                                const shared_ptr<Node>& residual)
+{
+    NodeVector args{data_batch, filters, bias};
+    if (residual)
+    {
+        args.push_back(residual);
+    }
+    return args;
+}
+
+op::ConvolutionBiasEpilogue::ConvolutionBiasEpilogue(const shared_ptr<Node>& data_batch,
+                                                     const shared_ptr<Node>& filters,
+                                                     const shared_ptr<Node>& bias,
+                                                     const shared_ptr<Node>& residual,
+                                                     const Strides& window_movement_strides,
+                                                     const Strides& window_dilation_strides,
+                                                     const CoordinateDiff& padding_below,
+                                                     const CoordinateDiff& padding_above,
+                                                     const Strides& data_dilation_strides,
+                                                     const vector<PostOp>& post_ops)
+    : RequiresTensorViewArgs("ConvolutionBiasEpilogue",
+                             epilogue_args(data_batch, filters, bias, residual))
+    , m_window_movement_strides(window_movement_strides)
+    , m_window_dilation_strides(window_dilation_strides)
+    , m_padding_below(padding_below)
+    , m_padding_above(padding_above)
+    , m_data_dilation_strides(data_dilation_strides)
+    , m_post_ops(post_ops)
+{
+    auto& data_batch_et = data_batch->get_element_type();
+    auto& filters_shape = filters->get_shape();
+
+    if (data_batch_et != filters->get_element_type() || data_batch_et != bias->get_element_type())
+    {
+        throw ngraph_error("Convolution data batch, filter and bias element types do not match");
+    }
+    if (bias->get_shape() != Shape{filters_shape.at(0)})
+    {
+        throw ngraph_error("Convolution bias must have one element per output channel");
+    }
+
+    Shape result_shape = util::infer_convolution_output_shape(data_batch->get_shape(),
+                                                              filters_shape,
+                                                              window_movement_strides,
+                                                              window_dilation_strides,
+                                                              padding_below,
+                                                              padding_above,
+                                                              data_dilation_strides,
+                                                              0, /* batch_axis_data,              */
+                                                              1, /* input_channel_axis_data,      */
+                                                              1, /* input_channel_axis_filters,   */
+                                                              0, /* output_channel_axis_filters,  */
+                                                              0, /* batch_axis_result,            */
+                                                              1, /* output_channel_axis_result,   */
+                                                              "");
+
+    size_t sums = 0;
+    for (auto& post_op : post_ops)
+    {
+        sums += (post_op.type == PostOpType::Sum) ? 1 : 0;
+    }
+    if (sums != (residual ? 1 : 0))
+    {
+        throw ngraph_error("ConvolutionBiasEpilogue needs exactly one Sum post-op per residual");
+    }
+    if (residual && (residual->get_element_type() != data_batch_et ||
+                     residual->get_shape() != result_shape))
+    {
+        throw ngraph_error("ConvolutionBiasEpilogue residual must match the convolution result");
+    }
+
+    set_value_type_checked(data_batch_et, result_shape);
+}
+
+shared_ptr<Node> op::ConvolutionBiasEpilogue::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != get_input_size())
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    return make_shared<ConvolutionBiasEpilogue>(new_args.at(0),
+                                                new_args.at(1),
+                                                new_args.at(2),
+                                                new_args.size() == 4 ? new_args.at(3) : nullptr,
+                                                get_window_movement_strides(),
+                                                get_window_dilation_strides(),
+                                                get_padding_below(),
+                                                get_padding_above(),
+                                                get_data_dilation_strides(),
+                                                get_post_ops());
+}
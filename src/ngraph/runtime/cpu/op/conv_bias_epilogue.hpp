@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Convolution + bias followed by a chain of elementwise post-ops applied to
+        /// the result before it is written, as MKLDNN post-ops.
+        class ConvolutionBiasEpilogue : public util::RequiresTensorViewArgs
+        {
+        public:
+            enum class PostOpType
+            {
+                Relu,
+                Tanh,
+                Sigmoid,
+                Abs,
+                Sqrt,
+                Linear,
+                Sum
+            };
+
+            /// Linear computes alpha * x + beta; Sum adds alpha times the residual input.
+            struct PostOp
+            {
+                PostOpType type;
+                float alpha;
+                float beta;
+            };
+
+            /// \param residual The tensor a Sum post-op adds, or nullptr if there is none.
+            /// \param post_ops Applied in order to the convolution + bias result.
+            ConvolutionBiasEpilogue(const std::shared_ptr<Node>& data_batch,
+                                    const std::shared_ptr<Node>& filters,
+                                    const std::shared_ptr<Node>& bias,
+                                    const std::shared_ptr<Node>& residual,
+                                    const Strides& window_movement_strides,
+                                    const Strides& window_dilation_strides,
+                                    const CoordinateDiff& padding_below,
+                                    const CoordinateDiff& padding_above,
+                                    const Strides& data_dilation_strides,
+                                    const std::vector<PostOp>& post_ops);
+
+            const Strides& get_window_movement_strides() const { return m_window_movement_strides; }
+            const Strides& get_window_dilation_strides() const { return m_window_dilation_strides; }
+            const CoordinateDiff& get_padding_below() const { return m_padding_below; }
+            const CoordinateDiff& get_padding_above() const { return m_padding_above; }
+            const Strides& get_data_dilation_strides() const { return m_data_dilation_strides; }
+            const std::vector<PostOp>& get_post_ops() const { return m_post_ops; }
+            bool has_residual() const { return get_input_size() == 4; }
+            std::shared_ptr<Node> get_bias() { return get_argument(2); }
+            std::shared_ptr<Node> get_filters() { return get_argument(1); }
+            std::shared_ptr<Node> get_data_batch() { return get_argument(0); }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            Strides m_window_movement_strides;
+            Strides m_window_dilation_strides;
+            CoordinateDiff m_padding_below;
+            CoordinateDiff m_padding_above;
+            Strides m_data_dilation_strides;
+            std::vector<PostOp> m_post_ops;
+        };
+    }
+}
@@ -0,0 +1,226 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+using Opcode = op::FusedElementwise::Opcode;
+
+static const unordered_map<type_index, Opcode> fusible_ops{
+    {TI(op::Abs), Opcode::Abs},
+    {TI(op::Exp), Opcode::Exp},
+    {TI(op::Log), Opcode::Log},
+    {TI(op::Negative), Opcode::Negative},
+    {TI(op::Relu), Opcode::Relu},
+    {TI(op::Sigmoid), Opcode::Sigmoid},
+    {TI(op::Sqrt), Opcode::Sqrt},
+    {TI(op::Tanh), Opcode::Tanh},
+    {TI(op::Add), Opcode::Add},
+    {TI(op::Divide), Opcode::Divide},
+    {TI(op::Maximum), Opcode::Maximum},
+    {TI(op::Minimum), Opcode::Minimum},
+    {TI(op::Multiply), Opcode::Multiply},
+    {TI(op::Subtract), Opcode::Subtract}};
+
+bool op::FusedElementwise::get_opcode(const Node& node, Opcode& opcode)
+{
+    auto it = fusible_ops.find(TI(node));
+    if (it == fusible_ops.end() || node.get_element_type() != element::f32)
+    {
+        return false;
+    }
+    opcode = it->second;
+    return true;
+}
+
+size_t op::FusedElementwise::get_arity(Opcode opcode)
+{
+    switch (opcode)
+    {
+    case Opcode::Abs:
+    case Opcode::Exp:
+    case Opcode::Log:
+    case Opcode::Negative:
+    case Opcode::Relu:
+    case Opcode::Sigmoid:
+    case Opcode::Sqrt:
+    case Opcode::Tanh: return 1;
+    case Opcode::Add:
+    case Opcode::Divide:
+    case Opcode::Maximum:
+    case Opcode::Minimum:
+    case Opcode::Multiply:
+    case Opcode::Subtract: return 2;
+    }
+    throw ngraph_error("Unknown FusedElementwise opcode");
+}
+
+op::FusedElementwise::FusedElementwise(const NodeVector& args,
+                                       const vector<AxisSet>& broadcast_axes,
+                                       const vector<Instruction>& program,
+                                       const Shape& shape)
+    : RequiresTensorViewArgs("FusedElementwise", args)
+    , m_broadcast_axes(broadcast_axes)
+    , m_program(program)
+{
+    if (args.empty() || args.size() != broadcast_axes.size())
+    {
+        throw ngraph_error("FusedElementwise needs one set of broadcast axes per input");
+    }
+    if (program.empty())
+    {
+        throw ngraph_error("FusedElementwise program is empty");
+    }
+
+    auto& et = args[0]->get_element_type();
+    size_t rank = shape.size();
+    vector<Strides> axis_strides;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        if (args[i]->get_element_type() != et)
+        {
+            throw ngraph_error("FusedElementwise input element type mismatch");
+        }
+        Shape expected;
+        for (size_t axis = 0; axis < rank; axis++)
+        {
+            if (broadcast_axes[i].count(axis) == 0)
+            {
+                expected.push_back(shape[axis]);
+            }
+        }
+        // Unit dimensions don't affect the layout, so numpy-style inputs that keep them in
+        // place of the broadcast axes are accepted too
+        auto squeeze = [](const Shape& s) {
+            Shape squeezed;
+            std::copy_if(s.begin(), s.end(), back_inserter(squeezed), [](size_t d) {
+                return d != 1;
+            });
+            return squeezed;
+        };
+        if (args[i]->get_shape() != expected &&
+            squeeze(args[i]->get_shape()) != squeeze(expected))
+        {
+            throw ngraph_error("FusedElementwise input " + to_string(i) + " has shape " +
+                               vector_to_string(args[i]->get_shape()) + ", expected " +
+                               vector_to_string(expected));
+        }
+
+        // Row-major strides of the input, expressed along the output axes
+        Strides strides(rank, 0);
+        size_t stride = 1;
+        for (size_t axis = rank; axis-- > 0;)
+        {
+            if (broadcast_axes[i].count(axis) == 0)
+            {
+                strides[axis] = stride;
+                stride *= shape[axis];
+            }
+        }
+        axis_strides.push_back(strides);
+    }
+
+    for (size_t k = 0; k < program.size(); k++)
+    {
+        auto& instruction = program[k];
+        if (instruction.operands.size() != get_arity(instruction.opcode))
+        {
+            throw ngraph_error("FusedElementwise instruction has the wrong number of operands");
+        }
+        for (size_t operand : instruction.operands)
+        {
+            if (operand >= args.size() + k)
+            {
+                throw ngraph_error("FusedElementwise operand refers to a later value");
+            }
+        }
+    }
+
+    // Drop unit axes and merge each axis into the previous one when every input is either
+    // broadcast along both or contiguous across both
+    m_input_strides.resize(args.size());
+    for (size_t axis = 0; axis < rank; axis++)
+    {
+        if (shape[axis] == 1)
+        {
+            continue;
+        }
+        bool merge = !m_loop_shape.empty();
+        for (size_t i = 0; merge && i < args.size(); i++)
+        {
+            size_t outer = m_input_strides[i].back();
+            size_t inner = axis_strides[i][axis];
+            merge = (outer == 0 && inner == 0) ||
+                    (outer != 0 && inner != 0 && outer == inner * shape[axis]);
+        }
+        if (merge)
+        {
+            m_loop_shape.back() *= shape[axis];
+            for (size_t i = 0; i < args.size(); i++)
+            {
+                m_input_strides[i].back() = axis_strides[i][axis];
+            }
+        }
+        else
+        {
+            m_loop_shape.push_back(shape[axis]);
+            for (size_t i = 0; i < args.size(); i++)
+            {
+                m_input_strides[i].push_back(axis_strides[i][axis]);
+            }
+        }
+    }
+    if (m_loop_shape.empty())
+    {
+        m_loop_shape.push_back(1);
+        for (auto& strides : m_input_strides)
+        {
+            strides.push_back(0);
+        }
+    }
+
+    add_output(et, shape);
+}
+
+shared_ptr<Node> op::FusedElementwise::copy_with_new_args(const NodeVector& new_args) const
+{
+    return make_shared<FusedElementwise>(new_args, m_broadcast_axes, m_program, get_shape());
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A connected group of elementwise ops (and the Broadcasts feeding them)
+        /// evaluated in a single pass over the output, so intermediate values never reach
+        /// memory.
+        class FusedElementwise : public util::RequiresTensorViewArgs
+        {
+        public:
+            enum class Opcode
+            {
+                Abs,
+                Exp,
+                Log,
+                Negative,
+                Relu,
+                Sigmoid,
+                Sqrt,
+                Tanh,
+                Add,
+                Divide,
+                Maximum,
+                Minimum,
+                Multiply,
+                Subtract
+            };
+
+            /// Operands index a value table holding the inputs followed by the result of each
+            /// earlier instruction. The last instruction produces the output.
+            struct Instruction
+            {
+                Opcode opcode;
+                std::vector<size_t> operands;
+            };
+
+            /// \param args The inputs of the group.
+            /// \param broadcast_axes For each input, the output axes it is broadcast along;
+            ///        empty for inputs that already have the output shape. An input may keep
+            ///        unit dimensions in place of its broadcast axes, as numpy does.
+            /// \param program The group's ops in topological order.
+            /// \param shape The output shape.
+            FusedElementwise(const NodeVector& args,
+                             const std::vector<AxisSet>& broadcast_axes,
+                             const std::vector<Instruction>& program,
+                             const Shape& shape);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            const std::vector<AxisSet>& get_broadcast_axes() const { return m_broadcast_axes; }
+            const std::vector<Instruction>& get_program() const { return m_program; }
+            /// The loop nest covering the output. Adjacent output axes are merged wherever
+            /// every input is broadcast the same way along both of them.
+            const Shape& get_loop_shape() const { return m_loop_shape; }
+            /// Element stride of each input along each loop axis (0 when broadcast)
+            const std::vector<Strides>& get_input_strides() const { return m_input_strides; }
+            static size_t get_arity(Opcode opcode);
+            /// \brief Looks up the opcode an f32 op lowers to.
+            /// \return false if the op can't join a FusedElementwise group.
+            static bool get_opcode(const Node& node, Opcode& opcode);
+
+        private:
+            std::vector<AxisSet> m_broadcast_axes;
+            std::vector<Instruction> m_program;
+            Shape m_loop_shape;
+            std::vector<Strides> m_input_strides;
+        };
+    }
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "matmul_bias_epilogue.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static NodeVector epilogue_args(const shared_ptr<Node>& W,
+                                const shared_ptr<Node>& x,
+                                const shared_ptr<Node>& b,
+                                const NodeVector& inputs)
+{
+    NodeVector args{W, x};
+    if (b)
+    {
+        args.push_back(b);
+    }
+    args.insert(args.end(), inputs.begin(), inputs.end());
+    return args;
+}
+
+op::MatmulBiasEpilogue::MatmulBiasEpilogue(const shared_ptr<Node>& W,
+                                           const shared_ptr<Node>& x,
+                                           const shared_ptr<Node>& b,
+                                           const NodeVector& inputs,
+                                           const Shape& shape_w,
+                                           const Shape& shape_x,
+                                           bool transpose_w,
+                                           bool transpose_x,
+                                           const AxisSet& axes,
+                                           const vector<AxisSet>& input_broadcast_axes,
+                                           const vector<FusedElementwise::Instruction>& program)
+    : RequiresTensorViewArgs("MatmulBiasEpilogue", epilogue_args(W, x, b, inputs))
+    , m_shape_w(shape_w)
+    , m_shape_x(shape_x)
+    , m_transpose_w(transpose_w)
+    , m_transpose_x(transpose_x)
+    , m_broadcast_axes(axes)
+    , m_has_bias(b != nullptr)
+    , m_input_broadcast_axes(input_broadcast_axes)
+    , m_program(program)
+{
+    if ((b == nullptr) != axes.empty())
+    {
+        throw ngraph_error("Broadcast axes must be given exactly when there is a bias");
+    }
+    if (shape_w.size() != 2 || shape_x.size() != 2)
+    {
+        throw ngraph_error("MatmulBiasEpilogue arguments must be matrices");
+    }
+
+    size_t dot_dimension_w = (transpose_w) ? 0 : 1;
+    size_t dot_dimension_x = (transpose_x) ? 1 : 0;
+    if (shape_w.at(dot_dimension_w) != shape_x.at(dot_dimension_x))
+    {
+        throw ngraph_error("product dimensions are not equal while creating MatmulBiasEpilogue");
+    }
+    Shape dot_shape{shape_w.at(1 - dot_dimension_w), shape_x.at(1 - dot_dimension_x)};
+
+    if (inputs.size() != input_broadcast_axes.size())
+    {
+        throw ngraph_error("MatmulBiasEpilogue needs one set of broadcast axes per input");
+    }
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        // As with FusedElementwise, broadcast axes may be kept as unit dimensions
+        size_t expected = 1;
+        for (size_t axis = 0; axis < 2; axis++)
+        {
+            expected *= input_broadcast_axes[i].count(axis) ? 1 : dot_shape[axis];
+        }
+        if (shape_size(inputs[i]->get_shape()) != expected ||
+            inputs[i]->get_element_type() != W->get_element_type())
+        {
+            throw ngraph_error("MatmulBiasEpilogue input " + to_string(i) + " has shape " +
+                               vector_to_string(inputs[i]->get_shape()));
+        }
+    }
+    if (program.empty())
+    {
+        throw ngraph_error("MatmulBiasEpilogue program is empty");
+    }
+    for (size_t k = 0; k < program.size(); k++)
+    {
+        auto& instruction = program[k];
+        if (instruction.operands.size() != FusedElementwise::get_arity(instruction.opcode))
+        {
+            throw ngraph_error("MatmulBiasEpilogue instruction has the wrong number of operands");
+        }
+        for (size_t operand : instruction.operands)
+        {
+            if (operand > inputs.size() + k)
+            {
+                throw ngraph_error("MatmulBiasEpilogue operand refers to a later value");
+            }
+        }
+    }
+
+    add_output(W->get_element_type(), dot_shape);
+}
+
+shared_ptr<Node> op::MatmulBiasEpilogue::copy_with_new_args(const NodeVector& new_args) const
+{
+    size_t first_input = get_first_input();
+    if (new_args.size() != first_input + m_input_broadcast_axes.size())
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    return make_shared<MatmulBiasEpilogue>(new_args.at(0),
+                                           new_args.at(1),
+                                           m_has_bias ? new_args.at(2) : nullptr,
+                                           vector<shared_ptr<Node>>(new_args.begin() + first_input,
+                                                                    new_args.end()),
+                                           m_shape_w,
+                                           m_shape_x,
+                                           m_transpose_w,
+                                           m_transpose_x,
+                                           m_broadcast_axes,
+                                           m_input_broadcast_axes,
+                                           m_program);
+}
@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief MatmulBias followed by a FusedElementwise-style program applied to each
+        /// block of the product while it is still in cache.
+        class MatmulBiasEpilogue : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \param b The bias, or nullptr if there is none.
+            /// \param axes The axes the bias is broadcast along.
+            /// \param inputs Extra inputs of the epilogue program.
+            /// \param input_broadcast_axes For each extra input, the output axes it is
+            ///        broadcast along, as for FusedElementwise.
+            /// \param program Operands index a value table holding the product (plus bias),
+            ///        then the extra inputs, then the result of each earlier instruction.
+            MatmulBiasEpilogue(const std::shared_ptr<Node>& W,
+                               const std::shared_ptr<Node>& x,
+                               const std::shared_ptr<Node>& b,
+                               const NodeVector& inputs,
+                               const Shape& shape_w,
+                               const Shape& shape_x,
+                               bool transpose_w,
+                               bool transpose_x,
+                               const AxisSet& axes,
+                               const std::vector<AxisSet>& input_broadcast_axes,
+                               const std::vector<FusedElementwise::Instruction>& program);
+
+            bool get_is_arg0_transposed() const { return m_transpose_w; }
+            bool get_is_arg1_transposed() const { return m_transpose_x; }
+            const Shape& get_arg0_shape() const { return m_shape_w; }
+            const Shape& get_arg1_shape() const { return m_shape_x; }
+            const AxisSet& get_broadcast_axes() const { return m_broadcast_axes; }
+            bool has_bias() const { return m_has_bias; }
+            /// Index of the first extra input among the arguments
+            size_t get_first_input() const { return m_has_bias ? 3 : 2; }
+            const std::vector<AxisSet>& get_input_broadcast_axes() const
+            {
+                return m_input_broadcast_axes;
+            }
+            const std::vector<FusedElementwise::Instruction>& get_program() const
+            {
+                return m_program;
+            }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            Shape m_shape_w;
+            Shape m_shape_x;
+            bool m_transpose_w;
+            bool m_transpose_x;
+            AxisSet m_broadcast_axes;
+            bool m_has_bias;
+            std::vector<AxisSet> m_input_broadcast_axes;
+            std::vector<FusedElementwise::Instruction> m_program;
+        };
+    }
+}
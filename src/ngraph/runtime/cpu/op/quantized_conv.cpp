@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static void check_quantized_convolution_types(const shared_ptr<Node>& data_batch,
+                                              const shared_ptr<Node>& filters,
+                                              const element::Type& output_type)
+{
+    if (data_batch->get_element_type() != element::u8)
+    {
+        throw ngraph_error("Quantized convolution data batch must be u8");
+    }
+    if (filters->get_element_type() != element::i8)
+    {
+        throw ngraph_error("Quantized convolution filters must be i8");
+    }
+    if (output_type != element::u8 && output_type != element::i8 &&
+        output_type != element::i32 && output_type != element::f32)
+    {
+        throw ngraph_error("Quantized convolution output must be u8, i8, i32 or f32");
+    }
+}
+
+static Shape infer_quantized_convolution_output_shape(const shared_ptr<Node>& data_batch,
+                                                      const shared_ptr<Node>& filters,
+                                                      const Strides& window_movement_strides,
+                                                      const Strides& window_dilation_strides,
+                                                      const CoordinateDiff& padding_below,
+                                                      const CoordinateDiff& padding_above,
+                                                      const Strides& data_dilation_strides)
+{
+    return op::util::infer_convolution_output_shape(data_batch->get_shape(),
+                                                    filters->get_shape(),
+                                                    window_movement_strides,
+                                                    window_dilation_strides,
+                                                    padding_below,
+                                                    padding_above,
+                                                    data_dilation_strides,
+                                                    0, /* batch_axis_data,              */
+                                                    1, /* input_channel_axis_data,      */
+                                                    1, /* input_channel_axis_filters,   */
+                                                    0, /* output_channel_axis_filters,  */
+                                                    0, /* batch_axis_result,            */
+                                                    1, /* output_channel_axis_result,   */
+                                                    "");
+}
+
+op::QuantizedConvolution::QuantizedConvolution(const shared_ptr<Node>& data_batch,
+                                               const shared_ptr<Node>& filters,
+                                               const Strides& window_movement_strides,
+                                               const Strides& window_dilation_strides,
+                                               const CoordinateDiff& padding_below,
+                                               const CoordinateDiff& padding_above,
+                                               const Strides& data_dilation_strides,
+                                               float requantization_scale,
+                                               const element::Type& output_type,
+                                               bool with_relu)
+    : RequiresTensorViewArgs("QuantizedConvolution", {data_batch, filters})
+    , m_window_movement_strides(window_movement_strides)
+    , m_window_dilation_strides(window_dilation_strides)
+    , m_padding_below(padding_below)
+    , m_padding_above(padding_above)
+    , m_data_dilation_strides(data_dilation_strides)
+    , m_requantization_scale(requantization_scale)
+    , m_with_relu(with_relu)
+{
+    check_quantized_convolution_types(data_batch, filters, output_type);
+
+    set_value_type_checked(output_type,
+                           infer_quantized_convolution_output_shape(data_batch,
+                                                                    filters,
+                                                                    window_movement_strides,
+                                                                    window_dilation_strides,
+                                                                    padding_below,
+                                                                    padding_above,
+                                                                    data_dilation_strides));
+}
+
+shared_ptr<Node> op::QuantizedConvolution::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    return shared_ptr<Node>(new QuantizedConvolution(new_args.at(0),
+                                                     new_args.at(1),
+                                                     get_window_movement_strides(),
+                                                     get_window_dilation_strides(),
+                                                     get_padding_below(),
+                                                     get_padding_above(),
+                                                     get_data_dilation_strides(),
+                                                     get_requantization_scale(),
+                                                     get_element_type(),
+                                                     with_relu()));
+}
+
+op::QuantizedConvolutionBias::QuantizedConvolutionBias(const shared_ptr<Node>& data_batch,
+                                                       const shared_ptr<Node>& filters,
+                                                       const shared_ptr<Node>& bias,
+                                                       const Strides& window_movement_strides,
+                                                       const Strides& window_dilation_strides,
+                                                       const CoordinateDiff& padding_below,
+                                                       const CoordinateDiff& padding_above,
+                                                       const Strides& data_dilation_strides,
+                                                       float requantization_scale,
+                                                       const element::Type& output_type,
+                                                       bool with_relu)
+    : RequiresTensorViewArgs("QuantizedConvolutionBias", {data_batch, filters, bias})
+    , m_window_movement_strides(window_movement_strides)
+    , m_window_dilation_strides(window_dilation_strides)
+    , m_padding_below(padding_below)
+    , m_padding_above(padding_above)
+    , m_data_dilation_strides(data_dilation_strides)
+    , m_requantization_scale(requantization_scale)
+    , m_with_relu(with_relu)
+{
+    check_quantized_convolution_types(data_batch, filters, output_type);
+    if (bias->get_element_type() != element::i32)
+    {
+        throw ngraph_error("Quantized convolution bias must be i32");
+    }
+
+    set_value_type_checked(output_type,
+                           infer_quantized_convolution_output_shape(data_batch,
+                                                                    filters,
+                                                                    window_movement_strides,
+                                                                    window_dilation_strides,
+                                                                    padding_below,
+                                                                    padding_above,
+                                                                    data_dilation_strides));
+}
+
+shared_ptr<Node> op::QuantizedConvolutionBias::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    return shared_ptr<Node>(new QuantizedConvolutionBias(new_args.at(0),
+                                                         new_args.at(1),
+                                                         new_args.at(2),
+                                                         get_window_movement_strides(),
+                                                         get_window_dilation_strides(),
+                                                         get_padding_below(),
+                                                         get_padding_above(),
+                                                         get_data_dilation_strides(),
+                                                         get_requantization_scale(),
+                                                         get_element_type(),
+                                                         with_relu()));
+}
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::QuantizedDot::QuantizedDot(const shared_ptr<Node>& arg0,
+                               const shared_ptr<Node>& arg1,
+                               float requantization_scale,
+                               const element::Type& output_type)
+    : RequiresTensorViewArgs("QuantizedDot", {arg0, arg1})
+    , m_requantization_scale(requantization_scale)
+{
+    if (arg0->get_element_type() != element::u8 || arg1->get_element_type() != element::i8)
+    {
+        throw ngraph_error("QuantizedDot expects u8 and i8 arguments");
+    }
+    if (output_type != element::u8 && output_type != element::i8 &&
+        output_type != element::i32 && output_type != element::f32)
+    {
+        throw ngraph_error("QuantizedDot output must be u8, i8, i32 or f32");
+    }
+
+    auto& shape0 = arg0->get_shape();
+    auto& shape1 = arg1->get_shape();
+    if (shape0.size() != 2 || shape1.size() != 2)
+    {
+        throw ngraph_error("QuantizedDot only supports matrix arguments");
+    }
+    if (shape0.at(1) != shape1.at(0))
+    {
+        throw ngraph_error("QuantizedDot reduction axes are not of the same length");
+    }
+
+    set_value_type_checked(output_type, Shape{shape0.at(0), shape1.at(1)});
+}
+
+shared_ptr<Node> op::QuantizedDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<QuantizedDot>(
+        new_args.at(0), new_args.at(1), m_requantization_scale, get_element_type());
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Matrix product of a u8 matrix with an i8 matrix. Products are accumulated in
+        ///        i32 and the accumulator is multiplied by the requantization scale and saturated
+        ///        to the output type.
+        class QuantizedDot : public util::RequiresTensorViewArgs
+        {
+        public:
+            QuantizedDot(const std::shared_ptr<Node>& arg0,
+                         const std::shared_ptr<Node>& arg1,
+                         float requantization_scale,
+                         const element::Type& output_type);
+
+            float get_requantization_scale() const { return m_requantization_scale; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            float m_requantization_scale;
+        };
+    }
+}
@@ -36,10 +36,12 @@
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_epilogue.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 
@@ -293,6 +295,72 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::ConvolutionBiasEpilogue)
+                {
+                    // CPUEpilogueFusion only attaches post-ops to convolutions MKLDNN supports
+                    auto convolution = static_cast<op::ConvolutionBiasEpilogue*>(node);
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->set_mkldnn_op(true);
+                    if (convolution->has_residual())
+                    {
+                        // The sum post-op accumulates into the residual's buffer
+                        op_annotations->add_in_place_oi_pair({0, 3});
+                    }
+                    convolution->set_op_annotations(op_annotations);
+                }
+
+                // MKLDNN 0.14 only has u8s8 convolutions over 2D spatial axes without data
+                // dilation; anything else stays unassigned and is rejected by the emitters
+                template <typename T>
+                static bool is_mkldnn_quantized_convolution(const Node* node)
+                {
+                    auto convolution = static_cast<const T*>(node);
+                    for (size_t s : convolution->get_data_dilation_strides())
+                    {
+                        if (s != 1)
+                        {
+                            return false;
+                        }
+                    }
+                    auto& output_type = node->get_element_type();
+                    return node->get_input_shape(0).size() == 4 &&
+                           node->get_input_shape(1).size() == 4 &&
+                           node->get_input_element_type(0) == element::u8 &&
+                           node->get_input_element_type(1) == element::i8 &&
+                           (output_type == element::u8 || output_type == element::i8 ||
+                            output_type == element::i32 || output_type == element::f32);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::QuantizedConvolution)
+                {
+                    auto convolution = static_cast<op::QuantizedConvolution*>(node);
+                    if (is_mkldnn_quantized_convolution<op::QuantizedConvolution>(node))
+                    {
+                        auto op_annotations =
+                            std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                        op_annotations->set_mkldnn_op(true);
+                        convolution->set_op_annotations(op_annotations);
+                    }
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::QuantizedConvolutionBias)
+                {
+                    auto convolution = static_cast<op::QuantizedConvolutionBias*>(node);
+                    if (is_mkldnn_quantized_convolution<op::QuantizedConvolutionBias>(node) &&
+                        node->get_input_shape(2).size() == 1 &&
+                        node->get_input_element_type(2) == element::i32)
+                    {
+                        auto op_annotations =
+                            std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                        op_annotations->set_mkldnn_op(true);
+                        convolution->set_op_annotations(op_annotations);
+                    }
+                }
+
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::ConvolutionBiasBackpropFiltersBias)
                 {
@@ -600,6 +668,8 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionRelu>},
     {TI(ngraph::op::ConvolutionBiasRelu),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionBiasRelu>},
+    {TI(ngraph::op::ConvolutionBiasEpilogue),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionBiasEpilogue>},
     {TI(ngraph::op::BatchNormRelu),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BatchNormRelu>},
     {TI(ngraph::op::ConvolutionBackpropData),
@@ -617,6 +687,10 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionBias>},
     {TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionBiasBackpropFiltersBias>},
+    {TI(ngraph::op::QuantizedConvolution),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::QuantizedConvolution>},
+    {TI(ngraph::op::QuantizedConvolutionBias),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::QuantizedConvolutionBias>},
     {TI(ngraph::op::Relu), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Relu>},
     {TI(ngraph::op::ReluBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ReluBackprop>},
@@ -0,0 +1,201 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+
+#include "cpu_elementwise_fusion.hpp"
+
+using namespace ngraph;
+
+// Ops CPUAssignment gave to MKLDNN keep its kernel and layouts
+static bool is_fusible(const std::shared_ptr<Node>& node)
+{
+    op::FusedElementwise::Opcode opcode;
+    return op::FusedElementwise::get_opcode(*node, opcode) &&
+           !runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get());
+}
+
+static bool is_implicitly_broadcast(const std::shared_ptr<Node>& node)
+{
+    auto binop = std::dynamic_pointer_cast<op::util::BinaryElementwise>(node);
+    return binop && binop->is_implicitly_broadcast();
+}
+
+// Output axes along which an argument of numpy-compatible shape `arg_shape` is broadcast
+static AxisSet numpy_broadcast_axes(const Shape& arg_shape, const Shape& shape)
+{
+    AxisSet axes;
+    size_t leading = shape.size() - arg_shape.size();
+    for (size_t axis = 0; axis < shape.size(); axis++)
+    {
+        if (axis < leading || (arg_shape[axis - leading] == 1 && shape[axis] != 1))
+        {
+            axes.insert(axis);
+        }
+    }
+    return axes;
+}
+
+static bool used_only_by(const std::shared_ptr<Node>& node, const std::unordered_set<Node*>& group)
+{
+    for (auto& user : node->get_users())
+    {
+        if (group.count(user.get()) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    auto ops = function->get_ordered_ops();
+    std::unordered_map<Node*, size_t> position;
+    for (auto& n : ops)
+    {
+        size_t next = position.size();
+        position[n.get()] = next;
+    }
+    std::unordered_set<Node*> fused;
+    bool modified = false;
+
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it)
+    {
+        auto root = *it;
+        if (!is_fusible(root) || fused.count(root.get()) != 0)
+        {
+            continue;
+        }
+
+        // Grow until no argument qualifies; an argument rejected because of a user outside
+        // the group may qualify once that user joins
+        std::unordered_set<Node*> group{root.get()};
+        std::unordered_set<Node*> broadcasts;
+        NodeVector members{root};
+        bool grown = true;
+        while (grown)
+        {
+            grown = false;
+            for (size_t i = 0; i < members.size(); i++)
+            {
+                for (auto& arg : members[i]->get_arguments())
+                {
+                    if (group.count(arg.get()) != 0 || fused.count(arg.get()) != 0 ||
+                        arg->get_shape() != root->get_shape() || !used_only_by(arg, group))
+                    {
+                        continue;
+                    }
+                    if (is_fusible(arg))
+                    {
+                        group.insert(arg.get());
+                        members.push_back(arg);
+                        grown = true;
+                    }
+                    else if (std::dynamic_pointer_cast<op::Broadcast>(arg) &&
+                             arg->get_element_type() == element::f32)
+                    {
+                        group.insert(arg.get());
+                        broadcasts.insert(arg.get());
+                        grown = true;
+                    }
+                }
+            }
+        }
+        // A lone implicitly broadcasting op is still worth lowering, since the fused kernel
+        // reads its smaller input with zero strides instead of materializing a broadcast
+        if (group.size() < 2 && !is_implicitly_broadcast(root))
+        {
+            continue;
+        }
+
+        // Inputs come first in the value table, each (tensor, broadcast) pair once
+        NodeVector inputs;
+        std::vector<AxisSet> broadcast_axes;
+        std::map<std::pair<Node*, AxisSet>, size_t> input_index;
+        std::unordered_map<Node*, size_t> value_index;
+        auto add_input = [&](const std::shared_ptr<Node>& input, const AxisSet& axes) {
+            auto key = std::make_pair(input.get(), axes);
+            auto found = input_index.find(key);
+            if (found != input_index.end())
+            {
+                return found->second;
+            }
+            inputs.push_back(input);
+            broadcast_axes.push_back(axes);
+            return input_index[key] = inputs.size() - 1;
+        };
+
+        std::sort(members.begin(),
+                  members.end(),
+                  [&](const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) {
+                      return position.at(a.get()) < position.at(b.get());
+                  });
+        for (auto& n : members)
+        {
+            for (auto& arg : n->get_arguments())
+            {
+                if (broadcasts.count(arg.get()) != 0)
+                {
+                    auto broadcast = std::static_pointer_cast<op::Broadcast>(arg);
+                    value_index[arg.get()] =
+                        add_input(broadcast->get_argument(0), broadcast->get_broadcast_axes());
+                }
+                else if (group.count(arg.get()) == 0)
+                {
+                    value_index[arg.get()] =
+                        add_input(arg, numpy_broadcast_axes(arg->get_shape(), root->get_shape()));
+                }
+            }
+        }
+
+        std::vector<op::FusedElementwise::Instruction> program;
+        for (auto& n : members)
+        {
+            op::FusedElementwise::Instruction instruction;
+            op::FusedElementwise::get_opcode(*n, instruction.opcode);
+            for (auto& arg : n->get_arguments())
+            {
+                instruction.operands.push_back(value_index.at(arg.get()));
+            }
+            value_index[n.get()] = inputs.size() + program.size();
+            program.push_back(instruction);
+        }
+
+        NGRAPH_DEBUG << "Fusing " << group.size() << " ops into " << root->get_name();
+        auto fused_op = std::make_shared<op::FusedElementwise>(
+            inputs, broadcast_axes, program, root->get_shape());
+        ngraph::replace_node(root, fused_op);
+        fused.insert(group.begin(), group.end());
+        modified = true;
+    }
+
+    return modified;
+}
@@ -0,0 +1,604 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_epilogue.hpp"
+#include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias_epilogue.hpp"
+
+#include "cpu_epilogue_fusion.hpp"
+
+using namespace ngraph;
+
+using Instruction = op::FusedElementwise::Instruction;
+using Opcode = op::FusedElementwise::Opcode;
+using PostOp = op::ConvolutionBiasEpilogue::PostOp;
+using PostOpType = op::ConvolutionBiasEpilogue::PostOpType;
+
+// The elementwise computation consuming an anchor, as a FusedElementwise program
+struct Epilogue
+{
+    std::shared_ptr<Node> consumer;
+    NodeVector inputs;
+    std::vector<AxisSet> broadcast_axes;
+    std::vector<Instruction> program;
+    size_t anchor;
+};
+
+static bool get_epilogue(const std::shared_ptr<Node>& anchor, Epilogue& epilogue)
+{
+    auto users = anchor->get_users();
+    if (users.size() != 1 || users[0]->get_shape() != anchor->get_shape())
+    {
+        return false;
+    }
+
+    epilogue.consumer = users[0];
+    if (auto fused = std::dynamic_pointer_cast<op::FusedElementwise>(epilogue.consumer))
+    {
+        epilogue.inputs = fused->get_arguments();
+        epilogue.broadcast_axes = fused->get_broadcast_axes();
+        epilogue.program = fused->get_program();
+    }
+    else
+    {
+        Instruction instruction;
+        auto binop = std::dynamic_pointer_cast<op::util::BinaryElementwise>(epilogue.consumer);
+        if (!op::FusedElementwise::get_opcode(*epilogue.consumer, instruction.opcode) ||
+            (binop && binop->is_implicitly_broadcast()))
+        {
+            return false;
+        }
+        // Broadcast arguments are read in place, as CPUElementwiseFusion would
+        for (auto& arg : epilogue.consumer->get_arguments())
+        {
+            auto broadcast = std::dynamic_pointer_cast<op::Broadcast>(arg);
+            if (broadcast && arg != anchor)
+            {
+                epilogue.inputs.push_back(broadcast->get_argument(0));
+                epilogue.broadcast_axes.push_back(broadcast->get_broadcast_axes());
+            }
+            else
+            {
+                epilogue.inputs.push_back(arg);
+                epilogue.broadcast_axes.push_back(AxisSet{});
+            }
+            instruction.operands.push_back(instruction.operands.size());
+        }
+        epilogue.program = {instruction};
+    }
+
+    auto it = std::find(epilogue.inputs.begin(), epilogue.inputs.end(), anchor);
+    if (it == epilogue.inputs.end())
+    {
+        return false;
+    }
+    epilogue.anchor = it - epilogue.inputs.begin();
+    return epilogue.broadcast_axes[epilogue.anchor].empty();
+}
+
+struct ConvolutionAnchor
+{
+    std::shared_ptr<Node> data_batch;
+    std::shared_ptr<Node> filters;
+    std::shared_ptr<Node> bias;
+    Strides window_movement_strides;
+    Strides window_dilation_strides;
+    CoordinateDiff padding_below;
+    CoordinateDiff padding_above;
+    Strides data_dilation_strides;
+    std::vector<PostOp> post_ops;
+    std::shared_ptr<Node> residual;
+};
+
+template <typename T>
+static ConvolutionAnchor make_convolution_anchor(const std::shared_ptr<T>& conv, bool relu)
+{
+    ConvolutionAnchor anchor;
+    anchor.data_batch = conv->get_argument(0);
+    anchor.filters = conv->get_argument(1);
+    anchor.bias = conv->get_input_size() > 2 ? conv->get_argument(2) : nullptr;
+    anchor.window_movement_strides = conv->get_window_movement_strides();
+    anchor.window_dilation_strides = conv->get_window_dilation_strides();
+    anchor.padding_below = conv->get_padding_below();
+    anchor.padding_above = conv->get_padding_above();
+    anchor.data_dilation_strides = conv->get_data_dilation_strides();
+    if (relu)
+    {
+        anchor.post_ops.push_back({PostOpType::Relu, 0, 0});
+    }
+    return anchor;
+}
+
+static bool get_convolution_anchor(const std::shared_ptr<Node>& node, ConvolutionAnchor& anchor)
+{
+    if (auto conv = std::dynamic_pointer_cast<op::Convolution>(node))
+    {
+        anchor = make_convolution_anchor(conv, false);
+    }
+    else if (auto conv_relu = std::dynamic_pointer_cast<op::ConvolutionRelu>(node))
+    {
+        anchor = make_convolution_anchor(conv_relu, true);
+    }
+    else if (auto conv_bias = std::dynamic_pointer_cast<op::ConvolutionBias>(node))
+    {
+        anchor = make_convolution_anchor(conv_bias, false);
+    }
+    else if (auto conv_bias_relu = std::dynamic_pointer_cast<op::ConvolutionBiasRelu>(node))
+    {
+        anchor = make_convolution_anchor(conv_bias_relu, true);
+    }
+    else if (auto conv_epilogue = std::dynamic_pointer_cast<op::ConvolutionBiasEpilogue>(node))
+    {
+        // An earlier fusion, extended by its next consumer
+        anchor = make_convolution_anchor(conv_epilogue, false);
+        anchor.post_ops = conv_epilogue->get_post_ops();
+        anchor.residual = conv_epilogue->has_residual() ? conv_epilogue->get_argument(3) : nullptr;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Same conditions CPUAssignment uses to pick the MKLDNN kernel
+    bool data_dilated = false;
+    for (size_t s : anchor.data_dilation_strides)
+    {
+        data_dilated = data_dilated || (s != 1);
+    }
+    return !data_dilated && node->get_element_type() == element::f32 &&
+           anchor.data_batch->get_shape().size() == 4 && anchor.filters->get_shape().size() == 4;
+}
+
+static bool get_uniform_constant(const std::shared_ptr<Node>& node, float& value)
+{
+    auto constant = std::dynamic_pointer_cast<op::Constant>(node);
+    if (!constant)
+    {
+        return false;
+    }
+    auto values = constant->get_vector<float>();
+    if (values.empty() ||
+        std::any_of(values.begin(), values.end(), [&](float v) { return v != values[0]; }))
+    {
+        return false;
+    }
+    value = values[0];
+    return true;
+}
+
+// A per-channel Add, Subtract or Multiply applied straight to the convolution output
+struct ChannelOp
+{
+    Opcode opcode;
+    std::shared_ptr<Node> input;
+};
+
+// Translates the epilogue of a convolution into post-ops, collecting the residual of a Sum
+// and the per-channel ops (e.g. an inference batch norm) that can be folded into the weights
+static bool get_post_ops(const Epilogue& epilogue,
+                         std::vector<PostOp>& post_ops,
+                         std::shared_ptr<Node>& residual,
+                         std::vector<ChannelOp>& channel_ops)
+{
+    size_t num_inputs = epilogue.inputs.size();
+    size_t current = epilogue.anchor;
+    for (size_t k = 0; k < epilogue.program.size(); k++)
+    {
+        auto& instruction = epilogue.program[k];
+        auto& operands = instruction.operands;
+        if (std::count(operands.begin(), operands.end(), current) != 1)
+        {
+            return false;
+        }
+
+        if (operands.size() == 1)
+        {
+            switch (instruction.opcode)
+            {
+            case Opcode::Abs: post_ops.push_back({PostOpType::Abs, 0, 0}); break;
+            case Opcode::Negative: post_ops.push_back({PostOpType::Linear, -1, 0}); break;
+            case Opcode::Relu: post_ops.push_back({PostOpType::Relu, 0, 0}); break;
+            case Opcode::Sigmoid: post_ops.push_back({PostOpType::Sigmoid, 0, 0}); break;
+            case Opcode::Sqrt: post_ops.push_back({PostOpType::Sqrt, 0, 0}); break;
+            case Opcode::Tanh: post_ops.push_back({PostOpType::Tanh, 0, 0}); break;
+            default: return false;
+            }
+        }
+        else
+        {
+            bool first = operands[0] == current;
+            size_t other = operands[first ? 1 : 0];
+            if (other >= num_inputs)
+            {
+                return false;
+            }
+            auto& input = epilogue.inputs[other];
+            auto& axes = epilogue.broadcast_axes[other];
+            float c;
+            if (get_uniform_constant(input, c))
+            {
+                switch (instruction.opcode)
+                {
+                case Opcode::Add: post_ops.push_back({PostOpType::Linear, 1, c}); break;
+                case Opcode::Multiply: post_ops.push_back({PostOpType::Linear, c, 0}); break;
+                case Opcode::Subtract:
+                    post_ops.push_back({PostOpType::Linear, first ? 1.f : -1.f, first ? -c : c});
+                    break;
+                case Opcode::Divide:
+                    if (!first || c == 0)
+                    {
+                        return false;
+                    }
+                    post_ops.push_back({PostOpType::Linear, 1 / c, 0});
+                    break;
+                case Opcode::Maximum:
+                    if (c != 0)
+                    {
+                        return false;
+                    }
+                    post_ops.push_back({PostOpType::Relu, 0, 0});
+                    break;
+                default: return false;
+                }
+            }
+            else if (instruction.opcode == Opcode::Add && axes.empty() && !residual)
+            {
+                post_ops.push_back({PostOpType::Sum, 1, 0});
+                residual = input;
+            }
+            else if ((instruction.opcode == Opcode::Add || instruction.opcode == Opcode::Multiply ||
+                      (instruction.opcode == Opcode::Subtract && first)) &&
+                     post_ops.empty() && axes == AxisSet{0, 2, 3})
+            {
+                channel_ops.push_back({instruction.opcode, input});
+            }
+            else
+            {
+                return false;
+            }
+        }
+        current = num_inputs + k;
+    }
+    return true;
+}
+
+// Composes adjacent Linear post-ops and drops the identity
+static std::vector<PostOp> simplify_post_ops(const std::vector<PostOp>& post_ops)
+{
+    std::vector<PostOp> simplified;
+    for (auto& post_op : post_ops)
+    {
+        if (post_op.type == PostOpType::Linear && !simplified.empty() &&
+            simplified.back().type == PostOpType::Linear)
+        {
+            auto& previous = simplified.back();
+            previous.beta = post_op.alpha * previous.beta + post_op.beta;
+            previous.alpha = post_op.alpha * previous.alpha;
+        }
+        else
+        {
+            simplified.push_back(post_op);
+        }
+        if (simplified.back().type == PostOpType::Linear && simplified.back().alpha == 1 &&
+            simplified.back().beta == 0)
+        {
+            simplified.pop_back();
+        }
+    }
+    return simplified;
+}
+
+// MKLDNN's JIT convolution kernels accept at most one relu on either side of a single sum;
+// other eltwise post-ops, or more of them, fall back to the reference kernel, which costs more
+// than the separate elementwise pass it would save
+static bool is_jit_supported(const std::vector<PostOp>& post_ops)
+{
+    size_t relus_before = 0;
+    size_t relus_after = 0;
+    size_t sums = 0;
+    for (auto& post_op : post_ops)
+    {
+        if (post_op.type == PostOpType::Sum)
+        {
+            sums++;
+        }
+        else if (post_op.type == PostOpType::Relu)
+        {
+            (sums == 0 ? relus_before : relus_after)++;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return sums <= 1 && relus_before <= 1 && relus_after <= 1;
+}
+
+static bool fuse_convolution_epilogue(const ConvolutionAnchor& anchor, const Epilogue& epilogue)
+{
+    std::vector<PostOp> post_ops = anchor.post_ops;
+    std::shared_ptr<Node> residual = anchor.residual;
+    std::vector<ChannelOp> channel_ops;
+    if (!get_post_ops(epilogue, post_ops, residual, channel_ops))
+    {
+        return false;
+    }
+    post_ops = simplify_post_ops(post_ops);
+
+    // A linear op straight on the convolution output is a uniform per-channel scale and shift
+    const Shape& filters_shape = anchor.filters->get_shape();
+    size_t channels = filters_shape.at(0);
+    const element::Type& element_type = anchor.filters->get_element_type();
+    auto uniform = [&](float value) {
+        return op::Constant::create(
+            element_type, Shape{channels}, std::vector<float>(channels, value));
+    };
+    if (!post_ops.empty() && post_ops.front().type == PostOpType::Linear)
+    {
+        auto& linear = post_ops.front();
+        if (linear.alpha != 1)
+        {
+            channel_ops.push_back({Opcode::Multiply, uniform(linear.alpha)});
+        }
+        if (linear.beta != 0)
+        {
+            channel_ops.push_back({Opcode::Add, uniform(linear.beta)});
+        }
+        post_ops.erase(post_ops.begin());
+    }
+    if (!is_jit_supported(post_ops))
+    {
+        NGRAPH_DEBUG << "Epilogue of " << epilogue.consumer->get_name()
+                     << " doesn't map onto JIT post-ops";
+        return false;
+    }
+
+    // Scales go into the filters and shifts into the bias; with constant operands
+    // ConstantFolding computes the new weights at compile time
+    std::shared_ptr<Node> filters = anchor.filters;
+    std::shared_ptr<Node> bias = anchor.bias;
+    for (auto& channel_op : channel_ops)
+    {
+        std::shared_ptr<Node> channel = channel_op.input;
+        if (channel->get_shape() != Shape{channels})
+        {
+            AxisVector order(channel->get_shape().size());
+            std::iota(order.begin(), order.end(), 0);
+            channel = std::make_shared<op::Reshape>(channel, order, Shape{channels});
+        }
+        switch (channel_op.opcode)
+        {
+        case Opcode::Multiply:
+            filters = std::make_shared<op::Multiply>(
+                filters, std::make_shared<op::Broadcast>(channel, filters_shape, AxisSet{1, 2, 3}));
+            bias = bias ? std::make_shared<op::Multiply>(bias, channel) : nullptr;
+            break;
+        case Opcode::Subtract:
+            if (bias)
+            {
+                bias = std::make_shared<op::Subtract>(bias, channel);
+            }
+            else
+            {
+                bias = std::make_shared<op::Negative>(channel);
+            }
+            break;
+        default: bias = bias ? std::make_shared<op::Add>(bias, channel) : channel; break;
+        }
+    }
+    if (!bias)
+    {
+        bias = uniform(0.f);
+    }
+
+    std::shared_ptr<Node> fused;
+    if (post_ops.empty())
+    {
+        fused = std::make_shared<op::ConvolutionBias>(anchor.data_batch,
+                                                      filters,
+                                                      bias,
+                                                      anchor.window_movement_strides,
+                                                      anchor.window_dilation_strides,
+                                                      anchor.padding_below,
+                                                      anchor.padding_above,
+                                                      anchor.data_dilation_strides);
+    }
+    else
+    {
+        fused = std::make_shared<op::ConvolutionBiasEpilogue>(anchor.data_batch,
+                                                              filters,
+                                                              bias,
+                                                              residual,
+                                                              anchor.window_movement_strides,
+                                                              anchor.window_dilation_strides,
+                                                              anchor.padding_below,
+                                                              anchor.padding_above,
+                                                              anchor.data_dilation_strides,
+                                                              post_ops);
+    }
+    NGRAPH_DEBUG << "Fusing " << epilogue.consumer->get_name() << " into " << fused->get_name();
+    ngraph::replace_node(epilogue.consumer, fused);
+    return true;
+}
+
+static bool fuse_matmul_epilogue(const std::shared_ptr<op::MatmulBias>& matmul,
+                                 const Epilogue& epilogue)
+{
+    // The product takes value 0, the remaining inputs follow in their original order
+    size_t num_inputs = epilogue.inputs.size();
+    std::vector<size_t> value(num_inputs);
+    NodeVector inputs;
+    std::vector<AxisSet> input_broadcast_axes;
+    for (size_t i = 0; i < num_inputs; i++)
+    {
+        if (i == epilogue.anchor)
+        {
+            value[i] = 0;
+            continue;
+        }
+        inputs.push_back(epilogue.inputs[i]);
+        input_broadcast_axes.push_back(epilogue.broadcast_axes[i]);
+        value[i] = inputs.size();
+    }
+    auto program = epilogue.program;
+    for (auto& instruction : program)
+    {
+        for (auto& operand : instruction.operands)
+        {
+            operand = operand < num_inputs ? value[operand] : operand;
+        }
+    }
+
+    auto args = matmul->get_arguments();
+    auto fused = std::make_shared<op::MatmulBiasEpilogue>(args.at(0),
+                                                          args.at(1),
+                                                          args.size() > 2 ? args.at(2) : nullptr,
+                                                          inputs,
+                                                          matmul->get_arg0_shape(),
+                                                          matmul->get_arg1_shape(),
+                                                          matmul->get_is_arg0_transposed(),
+                                                          matmul->get_is_arg1_transposed(),
+                                                          matmul->get_broadcast_axes(),
+                                                          input_broadcast_axes,
+                                                          program);
+    NGRAPH_DEBUG << "Fusing " << epilogue.consumer->get_name() << " into " << fused->get_name();
+    ngraph::replace_node(epilogue.consumer, fused);
+    return true;
+}
+
+// Appends the epilogue consuming an earlier matmul fusion to its program
+static bool extend_matmul_epilogue(const std::shared_ptr<op::MatmulBiasEpilogue>& matmul,
+                                   const Epilogue& epilogue)
+{
+    // Value table of the extension: the product, the earlier extra inputs, the new extra
+    // inputs, the earlier results and then the new ones
+    auto args = matmul->get_arguments();
+    size_t first_input = matmul->get_first_input();
+    NodeVector inputs;
+    inputs.assign(args.begin() + first_input, args.end());
+    std::vector<AxisSet> input_broadcast_axes = matmul->get_input_broadcast_axes();
+    size_t old_values = 1 + inputs.size();
+    for (size_t i = 0; i < epilogue.inputs.size(); i++)
+    {
+        if (i != epilogue.anchor)
+        {
+            inputs.push_back(epilogue.inputs[i]);
+            input_broadcast_axes.push_back(epilogue.broadcast_axes[i]);
+        }
+    }
+    size_t new_inputs = 1 + inputs.size() - old_values;
+
+    auto program = matmul->get_program();
+    for (auto& instruction : program)
+    {
+        for (auto& operand : instruction.operands)
+        {
+            operand = operand < old_values ? operand : operand + new_inputs;
+        }
+    }
+    size_t anchor_value = program.empty() ? 0 : old_values + new_inputs + program.size() - 1;
+    size_t first_result = old_values + new_inputs + program.size();
+    size_t num_inputs = epilogue.inputs.size();
+    for (auto instruction : epilogue.program)
+    {
+        for (auto& operand : instruction.operands)
+        {
+            if (operand == epilogue.anchor)
+            {
+                operand = anchor_value;
+            }
+            else if (operand < num_inputs)
+            {
+                operand = old_values + operand - (operand > epilogue.anchor ? 1 : 0);
+            }
+            else
+            {
+                operand = first_result + operand - num_inputs;
+            }
+        }
+        program.push_back(instruction);
+    }
+
+    auto fused = std::make_shared<op::MatmulBiasEpilogue>(args.at(0),
+                                                          args.at(1),
+                                                          matmul->has_bias() ? args.at(2) : nullptr,
+                                                          inputs,
+                                                          matmul->get_arg0_shape(),
+                                                          matmul->get_arg1_shape(),
+                                                          matmul->get_is_arg0_transposed(),
+                                                          matmul->get_is_arg1_transposed(),
+                                                          matmul->get_broadcast_axes(),
+                                                          input_broadcast_axes,
+                                                          program);
+    NGRAPH_DEBUG << "Fusing " << epilogue.consumer->get_name() << " into " << fused->get_name();
+    ngraph::replace_node(epilogue.consumer, fused);
+    return true;
+}
+
+bool runtime::cpu::pass::CPUEpilogueFusion::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    // Each round absorbs one more consumer into every fused op, so chains of elementwise ops
+    // are taken in whether or not CPUElementwiseFusion has grouped them yet
+    bool modified = false;
+    bool fused = true;
+    while (fused)
+    {
+        fused = false;
+        for (auto& n : function->get_ordered_ops())
+        {
+            Epilogue epilogue;
+            ConvolutionAnchor anchor;
+            if (get_convolution_anchor(n, anchor) && get_epilogue(n, epilogue))
+            {
+                fused |= fuse_convolution_epilogue(anchor, epilogue);
+            }
+            else if (n->get_element_type() != element::f32 || !get_epilogue(n, epilogue))
+            {
+                continue;
+            }
+            else if (auto matmul = std::dynamic_pointer_cast<op::MatmulBias>(n))
+            {
+                fused |= fuse_matmul_epilogue(matmul, epilogue);
+            }
+            else if (auto matmul_epilogue = std::dynamic_pointer_cast<op::MatmulBiasEpilogue>(n))
+            {
+                fused |= extend_matmul_epilogue(matmul_epilogue, epilogue);
+            }
+        }
+        modified |= fused;
+    }
+    return modified;
+}
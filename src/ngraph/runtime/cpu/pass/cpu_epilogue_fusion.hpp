@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Attaches the elementwise ops that consume a convolution or MatmulBias
+                /// to the op itself, so the result is post-processed before it is written.
+                ///
+                /// The consumer must be the only user of the anchor and either a single
+                /// fusible op or a FusedElementwise, so this runs after CPUElementwiseFusion.
+                /// Convolutions take chains that map onto MKLDNN post-ops: unary activations,
+                /// scaling or shifting by a scalar constant, and one residual Add.
+                /// Per-channel Add, Subtract and Multiply ahead of any of those, such as an
+                /// inference batch norm, are folded into the filters and bias. MatmulBias
+                /// takes any elementwise program, applied blockwise after the GEMM.
+                class CPUEpilogueFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -15,6 +15,9 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -36,16 +39,21 @@
 #include "ngraph/op/op.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/result.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_epilogue.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 
@@ -232,6 +240,228 @@ void runtime::cpu::pass::CPULayout::set_default_layouts(
     }
 }
 
+// Elementwise ops whose inputs all have the output's shape and element type compute the same
+// result on any layout, provided every operand uses the same one
+static bool is_layout_agnostic(const Node* node)
+{
+    if (!dynamic_cast<const ngraph::op::util::UnaryElementwiseArithmetic*>(node) &&
+        !dynamic_cast<const ngraph::op::util::BinaryElementwiseArithmetic*>(node) &&
+        !dynamic_cast<const ngraph::op::FusedElementwise*>(node))
+    {
+        return false;
+    }
+    if (node->get_output_size() != 1 || runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        if (node->get_input_shape(i) != node->get_output_shape(0) ||
+            node->get_input_element_type(i) != node->get_output_element_type(0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Blocked formats may pad the channel dimension, in which case flat elementwise kernels would
+// run over the padding and the buffer sizes no longer match the element count
+static bool is_propagatable_format(const Node* node, memory::format fmt)
+{
+    if (!runtime::cpu::mkldnn_utils::is_mkldnn_blocked_data_format(fmt))
+    {
+        return false;
+    }
+    const auto& shape = node->get_output_shape(0);
+    const auto& et = node->get_output_element_type(0);
+    memory::desc desc(memory::dims(shape.begin(), shape.end()),
+                      runtime::cpu::mkldnn_utils::get_mkldnn_data_type(et),
+                      fmt);
+    memory::primitive_desc pd(desc, runtime::cpu::mkldnn_utils::global_cpu_engine);
+    return pd.get_size() == shape_size(shape) * et.size();
+}
+
+// Convolutions query MKLDNN for their preferred (blocked) input format and reorder anything
+// else
+static bool prefers_blocked_input(const Node* node)
+{
+    return runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node) &&
+           (dynamic_cast<const ngraph::op::Convolution*>(node) ||
+            dynamic_cast<const ngraph::op::ConvolutionBias*>(node) ||
+            dynamic_cast<const ngraph::op::ConvolutionRelu*>(node) ||
+            dynamic_cast<const ngraph::op::ConvolutionBiasRelu*>(node) ||
+            dynamic_cast<const ngraph::op::ConvolutionBiasEpilogue*>(node) ||
+            dynamic_cast<const ngraph::op::GroupConvolution*>(node) ||
+            dynamic_cast<const ngraph::op::ConvolutionBackpropData*>(node) ||
+            dynamic_cast<const ngraph::op::ConvolutionBackpropFilters*>(node) ||
+            dynamic_cast<const ngraph::op::ConvolutionBiasBackpropFiltersBias*>(node));
+}
+
+// Inputs that have not been laid out yet are assumed to end up in the native format
+static memory::format get_expected_format(const descriptor::Input& input)
+{
+    auto tv = input.get_output().get_tensor_view();
+    auto cpu_tvl =
+        dynamic_cast<runtime::cpu::LayoutDescriptor*>(tv->get_tensor_view_layout().get());
+    if (cpu_tvl && cpu_tvl->get_mkldnn_format() != memory::format::format_undef)
+    {
+        return cpu_tvl->get_mkldnn_format();
+    }
+    return runtime::cpu::mkldnn_utils::CreateNativeDataFormat(
+        tv->get_tensor_view_type()->get_shape());
+}
+
+// Setting NGRAPH_CPU_NO_LAYOUT_PROPAGATION lays out every elementwise op in the native format,
+// which is useful to compare the number of inserted reorders
+static bool is_layout_propagation_enabled()
+{
+    return std::getenv("NGRAPH_CPU_NO_LAYOUT_PROPAGATION") == nullptr;
+}
+
+using ReorderCosts = std::map<std::pair<const Node*, memory::format>, size_t>;
+
+static size_t count_downstream_reorders(const Node* node,
+                                        memory::format fmt,
+                                        memory::format native,
+                                        ReorderCosts& costs);
+
+// Reorders needed once a value in format fmt reaches user, assuming every other input of user
+// keeps its expected format
+static size_t count_user_reorders(const Node* user, const Node* producer, memory::format fmt)
+{
+    size_t reorders = 0;
+    for (const descriptor::Input& input : user->get_inputs())
+    {
+        if (input.get_output().get_node().get() != producer &&
+            !runtime::cpu::mkldnn_utils::compare_mkldnn_formats(get_expected_format(input), fmt))
+        {
+            reorders++;
+        }
+    }
+    return reorders;
+}
+
+static size_t count_reorders_at(const Node* producer,
+                                const Node* user,
+                                memory::format fmt,
+                                memory::format native,
+                                ReorderCosts& costs)
+{
+    bool is_native = runtime::cpu::mkldnn_utils::compare_mkldnn_formats(fmt, native);
+    if (is_layout_agnostic(user))
+    {
+        size_t stay = std::numeric_limits<size_t>::max();
+        if (is_native || is_propagatable_format(user, fmt))
+        {
+            stay = count_user_reorders(user, producer, fmt) +
+                   count_downstream_reorders(user, fmt, native, costs);
+        }
+        if (is_native)
+        {
+            return stay;
+        }
+        size_t to_native = 1 + count_user_reorders(user, producer, native) +
+                           count_downstream_reorders(user, native, native, costs);
+        return std::min(stay, to_native);
+    }
+    if (prefers_blocked_input(user))
+    {
+        return is_native ? 1 : 0;
+    }
+    if (auto result = dynamic_cast<const ngraph::op::Result*>(user))
+    {
+        return (!is_native && result->needs_default_layout()) ? 1 : 0;
+    }
+    if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(user))
+    {
+        // Other MKLDNN kernels adopt the layout of their data input
+        return 0;
+    }
+    return is_native ? 0 : 1;
+}
+
+static size_t count_downstream_reorders(const Node* node,
+                                        memory::format fmt,
+                                        memory::format native,
+                                        ReorderCosts& costs)
+{
+    auto key = std::make_pair(node, fmt);
+    auto it = costs.find(key);
+    if (it != costs.end())
+    {
+        return it->second;
+    }
+    size_t reorders = 0;
+    for (const auto& user : node->get_users())
+    {
+        reorders += count_reorders_at(node, user.get(), fmt, native, costs);
+    }
+    costs[key] = reorders;
+    return reorders;
+}
+
+void runtime::cpu::pass::CPULayout::set_propagated_layouts(
+    runtime::cpu::CPU_ExternalFunction* external_function, std::shared_ptr<Node> node)
+{
+    if (!is_layout_agnostic(node.get()) || !is_layout_propagation_enabled())
+    {
+        set_default_layouts(external_function, node);
+        return;
+    }
+
+    auto native = mkldnn_utils::CreateNativeDataFormat(node->get_output_shape(0));
+    vector<memory::format> candidates{native};
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        auto fmt = mkldnn_utils::get_input_mkldnn_format(node.get(), i);
+        if (std::find(candidates.begin(), candidates.end(), fmt) == candidates.end() &&
+            is_propagatable_format(node.get(), fmt))
+        {
+            candidates.push_back(fmt);
+        }
+    }
+    if (candidates.size() == 1)
+    {
+        set_default_layouts(external_function, node);
+        return;
+    }
+
+    // Pick the format minimizing the reorders on the inputs plus those it causes downstream.
+    // Ties keep the native format.
+    ReorderCosts costs;
+    memory::format best = native;
+    size_t best_reorders = std::numeric_limits<size_t>::max();
+    for (auto fmt : candidates)
+    {
+        size_t reorders = count_downstream_reorders(node.get(), fmt, native, costs);
+        for (size_t i = 0; i < node->get_input_size(); i++)
+        {
+            if (!mkldnn_utils::compare_mkldnn_formats(
+                    mkldnn_utils::get_input_mkldnn_format(node.get(), i), fmt))
+            {
+                reorders++;
+            }
+        }
+        if (reorders < best_reorders)
+        {
+            best = fmt;
+            best_reorders = reorders;
+        }
+    }
+
+    if (best == native)
+    {
+        set_default_layouts(external_function, node);
+        return;
+    }
+    NGRAPH_DEBUG << "Propagating layout " << best << " through " << node->get_name();
+    vector<memory::format> prim_input_formats(node->get_input_size(), best);
+    vector<memory::format> prim_output_formats{best};
+    node = insert_input_conversions(external_function, node, prim_input_formats);
+    set_output_layouts(node, prim_output_formats);
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -267,8 +497,15 @@ namespace ngraph
                         window_dilation_strides_adjusted.push_back(s - 1);
                     }
 
-                    memory::data_type et = runtime::cpu::mkldnn_utils::get_mkldnn_data_type(
+                    // Quantized convolutions mix u8 data, i8 filters and i32 bias
+                    memory::data_type input_et = runtime::cpu::mkldnn_utils::get_mkldnn_data_type(
                         node->get_input_element_type(0));
+                    memory::data_type weights_et =
+                        runtime::cpu::mkldnn_utils::get_mkldnn_data_type(
+                            node->get_input_element_type(1));
+                    memory::data_type result_et =
+                        runtime::cpu::mkldnn_utils::get_mkldnn_data_type(
+                            node->get_output_element_type(0));
 
                     engine cpu_engine(engine::cpu, 0);
                     memory::dims mkldnn_arg0_shape(arg0_shape.begin(), arg0_shape.end());
@@ -280,15 +517,22 @@ namespace ngraph
                                                         window_dilation_strides_adjusted.end());
                     memory::dims mkldnn_padding_below(padding_below.begin(), padding_below.end());
                     memory::dims mkldnn_padding_above(padding_above.begin(), padding_above.end());
-                    const memory::desc input_data_desc(mkldnn_arg0_shape, et, memory::format::any);
-                    const memory::desc weights_desc(mkldnn_arg1_shape, et, memory::format::any);
-                    const memory::desc result_desc(mkldnn_result_shape, et, memory::format::any);
+                    const memory::desc input_data_desc(
+                        mkldnn_arg0_shape, input_et, memory::format::any);
+                    const memory::desc weights_desc(
+                        mkldnn_arg1_shape, weights_et, memory::format::any);
+                    const memory::desc result_desc(
+                        mkldnn_result_shape, result_et, memory::format::any);
                     std::unique_ptr<convolution_forward::desc> fwd_desc{nullptr};
                     if (use_bias)
                     {
                         auto arg2_shape = node->get_input_shape(2);
                         memory::dims mkldnn_arg2_shape(arg2_shape.begin(), arg2_shape.end());
-                        const memory::desc bias_desc(mkldnn_arg2_shape, et, memory::format::any);
+                        memory::data_type bias_et =
+                            runtime::cpu::mkldnn_utils::get_mkldnn_data_type(
+                                node->get_input_element_type(2));
+                        const memory::desc bias_desc(
+                            mkldnn_arg2_shape, bias_et, memory::format::any);
                         try
                         {
                             fwd_desc.reset(
@@ -457,6 +701,69 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::ConvolutionBiasEpilogue)
+                {
+                    if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get()))
+                    {
+                        vector<memory::format> prim_input_formats;
+                        vector<memory::format> prim_output_formats;
+                        ConvolutionLayout<ngraph::op::ConvolutionBiasEpilogue, true, false>(
+                            node, prim_input_formats, prim_output_formats);
+                        // The sum post-op accumulates into the destination, so the residual
+                        // has to arrive in the destination's layout
+                        if (node->get_input_size() == 4)
+                        {
+                            prim_input_formats.push_back(prim_output_formats[0]);
+                        }
+                        node =
+                            insert_input_conversions(external_function, node, prim_input_formats);
+                        set_output_layouts(node, prim_output_formats);
+                    }
+                    else
+                    {
+                        set_default_layouts(external_function, node);
+                    }
+                }
+
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::QuantizedConvolution)
+                {
+                    if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get()))
+                    {
+                        vector<memory::format> prim_input_formats;
+                        vector<memory::format> prim_output_formats;
+                        ConvolutionLayout<ngraph::op::QuantizedConvolution, false, false>(
+                            node, prim_input_formats, prim_output_formats);
+                        node =
+                            insert_input_conversions(external_function, node, prim_input_formats);
+                        set_output_layouts(node, prim_output_formats);
+                    }
+                    else
+                    {
+                        set_default_layouts(external_function, node);
+                    }
+                }
+
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::QuantizedConvolutionBias)
+                {
+                    if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get()))
+                    {
+                        vector<memory::format> prim_input_formats;
+                        vector<memory::format> prim_output_formats;
+                        ConvolutionLayout<ngraph::op::QuantizedConvolutionBias, true, false>(
+                            node, prim_input_formats, prim_output_formats);
+                        node =
+                            insert_input_conversions(external_function, node, prim_input_formats);
+                        set_output_layouts(node, prim_output_formats);
+                    }
+                    else
+                    {
+                        set_default_layouts(external_function, node);
+                    }
+                }
+
                 template <>
                 void CPULayout::LAYOUT_DECL(ngraph::op::ConvolutionBackpropData)
                 {
@@ -1122,7 +1429,7 @@ namespace ngraph
                     }
                     else
                     {
-                        set_default_layouts(external_function, node);
+                        set_propagated_layouts(external_function, node);
                     }
                 }
 
@@ -1139,7 +1446,7 @@ namespace ngraph
                     }
                     else
                     {
-                        set_default_layouts(external_function, node);
+                        set_propagated_layouts(external_function, node);
                     }
                 }
 
@@ -1340,7 +1647,7 @@ namespace ngraph
                     }
                     else
                     {
-                        set_default_layouts(external_function, node);
+                        set_propagated_layouts(external_function, node);
                     }
                 }
 
@@ -1474,6 +1781,12 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::ConvolutionRelu>},
     {TI(ngraph::op::ConvolutionBiasRelu),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::ConvolutionBiasRelu>},
+    {TI(ngraph::op::ConvolutionBiasEpilogue),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::ConvolutionBiasEpilogue>},
+    {TI(ngraph::op::QuantizedConvolution),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedConvolution>},
+    {TI(ngraph::op::QuantizedConvolutionBias),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedConvolutionBias>},
     {TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::ConvolutionBiasBackpropFiltersBias>},
     {TI(ngraph::op::BatchNorm), &runtime::cpu::pass::CPULayout::layout<ngraph::op::BatchNorm>},
@@ -1504,11 +1817,26 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         {
             handler->second(m_external_function, node);
         }
+        else if (is_layout_agnostic(node.get()))
+        {
+            set_propagated_layouts(m_external_function, node);
+        }
         else
         {
             set_default_layouts(m_external_function, node);
         }
     }
 
+    size_t reorders = 0;
+    for (const auto& node : m_external_function->get_function()->get_ordered_ops())
+    {
+        if (dynamic_cast<runtime::cpu::op::ConvertLayout*>(node.get()))
+        {
+            reorders++;
+        }
+    }
+    NGRAPH_DEBUG << "CPULayout inserted " << reorders << " layout conversions"
+                 << (is_layout_propagation_enabled() ? "" : " without layout propagation");
+
     return false;
 }
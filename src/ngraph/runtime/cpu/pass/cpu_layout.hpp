@@ -63,6 +63,11 @@ namespace ngraph
                     static void set_default_layouts(CPU_ExternalFunction* external_function,
                                                     std::shared_ptr<Node> node,
                                                     bool use_replace);
+                    // Lays out a layout-agnostic elementwise op in whichever format (native or
+                    // the blocked format of one of its inputs) needs the fewest reorders
+                    // around it and its users
+                    static void set_propagated_layouts(CPU_ExternalFunction* external_function,
+                                                       std::shared_ptr<Node> node);
                 };
             }
         }
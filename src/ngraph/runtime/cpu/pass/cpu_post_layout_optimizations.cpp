@@ -17,6 +17,9 @@
 #include <algorithm>
 #include <typeindex>
 #include <unordered_set>
+#include <vector>
+
+#include <mkldnn.hpp>
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -30,6 +33,7 @@
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 
@@ -116,3 +120,76 @@ void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::construct_weight_fu
     auto m = make_shared<pattern::Matcher>(conv, callback);
     this->add_matcher(m);
 }
+
+void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::construct_constant_reorder()
+{
+    auto constant = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{16, 4, 1, 1}, pattern::has_class<ngraph::op::Constant>());
+    auto tvt = constant->get_outputs().at(0).get_tensor_view().get();
+    auto lt_desc = std::make_shared<runtime::cpu::LayoutDescriptor>(*tvt, AxisVector{0, 1, 2, 3});
+    auto cvt_lt = std::make_shared<runtime::cpu::op::ConvertLayout>(constant, lt_desc);
+
+    pattern::graph_rewrite_callback callback = [constant](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_constant_reorder against "
+                     << m.get_match_root()->get_name();
+
+        auto m_cvt_lt = m.get_match_root();
+        auto m_constant =
+            std::static_pointer_cast<ngraph::op::Constant>(m.get_pattern_map()[constant]);
+
+        auto input_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(m_cvt_lt.get(), 0);
+        auto output_format =
+            runtime::cpu::mkldnn_utils::get_output_mkldnn_format(m_cvt_lt.get(), 0);
+        auto input_tvl = std::static_pointer_cast<runtime::cpu::LayoutDescriptor>(
+            m_constant->get_output_tensor_view(0)->get_tensor_view_layout());
+        auto shape = m_cvt_lt->get_shape();
+        auto et = m_cvt_lt->get_element_type();
+        if (input_tvl->get_axis_order() !=
+            runtime::cpu::LayoutDescriptor::create_native_axis_order(shape.size()))
+        {
+            return false;
+        }
+
+        // Same format name canonicalization as the ConvertLayout emitter
+        if (input_format == mkldnn::memory::format::nchw &&
+            runtime::cpu::mkldnn_utils::is_mkldnn_filter_format(output_format))
+        {
+            input_format = mkldnn::memory::format::oihw;
+        }
+
+        mkldnn::memory::dims dims(shape.begin(), shape.end());
+        auto data_type = runtime::cpu::mkldnn_utils::get_mkldnn_data_type(et);
+        mkldnn::memory::primitive_desc input_pd({dims, data_type, input_format},
+                                                runtime::cpu::mkldnn_utils::global_cpu_engine);
+        mkldnn::memory::primitive_desc output_pd({dims, data_type, output_format},
+                                                 runtime::cpu::mkldnn_utils::global_cpu_engine);
+        // Padded layouts do not fit in a constant of the same shape
+        size_t size = shape_size(shape) * et.size();
+        if (input_pd.get_size() != size || output_pd.get_size() != size)
+        {
+            NGRAPH_DEBUG << "Skipping padded layout for " << m_constant->get_name();
+            return false;
+        }
+
+        std::vector<char> reordered(size);
+        mkldnn::memory input(input_pd, const_cast<void*>(m_constant->get_data_ptr()));
+        mkldnn::memory output(output_pd, reordered.data());
+        mkldnn::stream s(mkldnn::stream::kind::eager);
+        s.submit({mkldnn::reorder(input, output)}).wait();
+
+        auto new_constant = std::make_shared<ngraph::op::Constant>(et, shape, reordered.data());
+        auto tv = new_constant->get_output_tensor_view(0);
+        auto layout = std::make_shared<runtime::cpu::LayoutDescriptor>(
+            *tv, runtime::cpu::LayoutDescriptor::create_native_axis_order(shape.size()));
+        layout->set_mkldnn_format(output_format);
+        tv->set_tensor_view_layout(layout);
+
+        NGRAPH_DEBUG << "Reordered " << m_constant->get_name() << " into "
+                     << new_constant->get_name() << " at compile time";
+        ngraph::replace_node(m_cvt_lt, new_constant);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(cvt_lt, callback);
+    this->add_matcher(m);
+}
@@ -38,6 +38,10 @@ public:
         : GraphRewrite()
     {
         construct_weight_fusion();
+        construct_constant_reorder();
     }
     void construct_weight_fusion();
+    /// \brief Replaces layout conversions of constants, typically convolution weights, with
+    ///        constants reordered once at compile time
+    void construct_constant_reorder();
 };
@@ -0,0 +1,246 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+
+#include "cpu_quantization_fusion.hpp"
+
+using namespace ngraph;
+
+static std::shared_ptr<op::Dequantize> get_dequantize(const std::shared_ptr<Node>& node,
+                                                      const element::Type& quantized_type)
+{
+    auto dequantize = std::dynamic_pointer_cast<op::Dequantize>(node);
+    if (dequantize && dequantize->get_zero_point() == 0 &&
+        dequantize->get_input_element_type(0) == quantized_type)
+    {
+        return dequantize;
+    }
+    return nullptr;
+}
+
+// MKLDNN int8 primitives have no output zero point, so only symmetric requantization folds
+static std::shared_ptr<op::Quantize> get_output_quantize(const std::shared_ptr<Node>& node)
+{
+    auto users = node->get_users();
+    if (users.size() != 1)
+    {
+        return nullptr;
+    }
+    auto quantize = std::dynamic_pointer_cast<op::Quantize>(users.at(0));
+    if (quantize && quantize->get_zero_point() == 0)
+    {
+        return quantize;
+    }
+    return nullptr;
+}
+
+static std::shared_ptr<Node> quantize_bias(const std::shared_ptr<Node>& bias, float scale)
+{
+    if (auto constant = std::dynamic_pointer_cast<op::Constant>(bias))
+    {
+        std::vector<float> values = constant->get_vector<float>();
+        std::vector<int32_t> quantized(values.size());
+        runtime::reference::quantize<float, int32_t>(
+            values.data(), quantized.data(), values.size(), scale, 0);
+        return std::make_shared<op::Constant>(element::i32, bias->get_shape(), quantized);
+    }
+    return std::make_shared<op::Quantize>(bias, scale, 0, element::i32);
+}
+
+template <typename T>
+static bool is_mkldnn_convolution(const std::shared_ptr<Node>& node)
+{
+    auto convolution = std::static_pointer_cast<T>(node);
+    for (size_t s : convolution->get_data_dilation_strides())
+    {
+        if (s != 1)
+        {
+            return false;
+        }
+    }
+    return node->get_input_shape(0).size() == 4 && node->get_input_shape(1).size() == 4;
+}
+
+template <typename T>
+static std::shared_ptr<Node> make_quantized_convolution(const std::shared_ptr<Node>& node,
+                                                        const std::shared_ptr<Node>& data,
+                                                        const std::shared_ptr<Node>& filters,
+                                                        const std::shared_ptr<Node>& bias,
+                                                        float requantization_scale,
+                                                        const element::Type& output_type,
+                                                        bool with_relu)
+{
+    auto convolution = std::static_pointer_cast<T>(node);
+    if (bias)
+    {
+        return std::make_shared<op::QuantizedConvolutionBias>(
+            data,
+            filters,
+            bias,
+            convolution->get_window_movement_strides(),
+            convolution->get_window_dilation_strides(),
+            convolution->get_padding_below(),
+            convolution->get_padding_above(),
+            convolution->get_data_dilation_strides(),
+            requantization_scale,
+            output_type,
+            with_relu);
+    }
+    return std::make_shared<op::QuantizedConvolution>(data,
+                                                      filters,
+                                                      convolution->get_window_movement_strides(),
+                                                      convolution->get_window_dilation_strides(),
+                                                      convolution->get_padding_below(),
+                                                      convolution->get_padding_above(),
+                                                      convolution->get_data_dilation_strides(),
+                                                      requantization_scale,
+                                                      output_type,
+                                                      with_relu);
+}
+
+static bool is_plain_matrix_product(const std::shared_ptr<Node>& node)
+{
+    if (auto dot = std::dynamic_pointer_cast<op::Dot>(node))
+    {
+        return dot->get_reduction_axes_count() == 1 && node->get_input_shape(0).size() == 2 &&
+               node->get_input_shape(1).size() == 2;
+    }
+    if (auto matmul = std::dynamic_pointer_cast<op::MatmulBias>(node))
+    {
+        return node->get_input_size() == 2 && !matmul->get_is_arg0_transposed() &&
+               !matmul->get_is_arg1_transposed() && node->get_input_shape(0).size() == 2 &&
+               node->get_input_shape(1).size() == 2;
+    }
+    return false;
+}
+
+bool ngraph::runtime::cpu::pass::CPUQuantizationFusion::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    bool clobbered = false;
+
+    for (const auto& n : function->get_ordered_ops())
+    {
+        bool is_convolution = std::dynamic_pointer_cast<op::Convolution>(n) ||
+                              std::dynamic_pointer_cast<op::ConvolutionRelu>(n) ||
+                              std::dynamic_pointer_cast<op::ConvolutionBias>(n) ||
+                              std::dynamic_pointer_cast<op::ConvolutionBiasRelu>(n);
+        bool is_dot = is_plain_matrix_product(n);
+        if (!is_convolution && !is_dot)
+        {
+            continue;
+        }
+
+        auto data = get_dequantize(n->get_argument(0), element::u8);
+        auto filters = get_dequantize(n->get_argument(1), element::i8);
+        if (!data || !filters)
+        {
+            continue;
+        }
+
+        // Accumulator units are data_scale * filter_scale
+        float input_scale = data->get_scale() * filters->get_scale();
+        float requantization_scale = input_scale;
+        element::Type output_type = element::f32;
+        std::shared_ptr<Node> root = n;
+        if (auto quantize = get_output_quantize(n))
+        {
+            requantization_scale = input_scale / quantize->get_scale();
+            output_type = quantize->get_element_type();
+            root = quantize;
+        }
+
+        auto data_q = data->get_argument(0);
+        auto filters_q = filters->get_argument(0);
+        std::shared_ptr<Node> fused;
+        if (std::dynamic_pointer_cast<op::Convolution>(n))
+        {
+            if (is_mkldnn_convolution<op::Convolution>(n))
+            {
+                fused = make_quantized_convolution<op::Convolution>(
+                    n, data_q, filters_q, nullptr, requantization_scale, output_type, false);
+            }
+        }
+        else if (std::dynamic_pointer_cast<op::ConvolutionRelu>(n))
+        {
+            if (is_mkldnn_convolution<op::ConvolutionRelu>(n))
+            {
+                fused = make_quantized_convolution<op::ConvolutionRelu>(
+                    n, data_q, filters_q, nullptr, requantization_scale, output_type, true);
+            }
+        }
+        else if (std::dynamic_pointer_cast<op::ConvolutionBias>(n))
+        {
+            if (is_mkldnn_convolution<op::ConvolutionBias>(n))
+            {
+                fused = make_quantized_convolution<op::ConvolutionBias>(
+                    n,
+                    data_q,
+                    filters_q,
+                    quantize_bias(n->get_argument(2), input_scale),
+                    requantization_scale,
+                    output_type,
+                    false);
+            }
+        }
+        else if (std::dynamic_pointer_cast<op::ConvolutionBiasRelu>(n))
+        {
+            if (is_mkldnn_convolution<op::ConvolutionBiasRelu>(n))
+            {
+                fused = make_quantized_convolution<op::ConvolutionBiasRelu>(
+                    n,
+                    data_q,
+                    filters_q,
+                    quantize_bias(n->get_argument(2), input_scale),
+                    requantization_scale,
+                    output_type,
+                    true);
+            }
+        }
+        else
+        {
+            fused = std::make_shared<op::QuantizedDot>(
+                data_q, filters_q, requantization_scale, output_type);
+        }
+
+        if (fused)
+        {
+            NGRAPH_DEBUG << "Quantization fusion replaced " << root->get_name() << " with "
+                         << fused->get_name();
+            ngraph::replace_node(root, fused);
+            clobbered = true;
+        }
+    }
+
+    return clobbered;
+}
@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Folds Dequantize -> op -> Quantize chains into int8 ops.
+                ///
+                /// Convolution, ConvolutionRelu, ConvolutionBias, ConvolutionBiasRelu, Dot and
+                /// plain MatmulBias whose data input is a Dequantize of u8 and whose filters/
+                /// weights input is a Dequantize of i8 (both with a zero point of 0) become
+                /// QuantizedConvolution, QuantizedConvolutionBias or QuantizedDot. A single
+                /// consuming Quantize with a zero point of 0 is folded into the requantization
+                /// scale; otherwise the fused op produces f32 directly. f32 biases are quantized
+                /// to i32 with the product of the input scales.
+                class CPUQuantizationFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/function.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/get_output_element.hpp"
+
+#include "cpu_reduced_precision_lowering.hpp"
+
+using namespace ngraph;
+
+static bool is_reduced_precision(const element::Type& type)
+{
+    return type == element::f16 || type == element::bf16;
+}
+
+static bool needs_lowering(const std::shared_ptr<Node>& n)
+{
+    if (n->is_parameter() || n->is_constant() || n->is_output() ||
+        std::dynamic_pointer_cast<op::Convert>(n) ||
+        std::dynamic_pointer_cast<op::GetOutputElement>(n) || !n->get_functions().empty())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < n->get_input_size(); i++)
+    {
+        if (is_reduced_precision(n->get_input_element_type(i)))
+        {
+            return true;
+        }
+    }
+    for (size_t i = 0; i < n->get_output_size(); i++)
+    {
+        if (is_reduced_precision(n->get_output_element_type(i)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ngraph::runtime::cpu::pass::CPUReducedPrecisionLowering::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    bool clobbered = false;
+
+    for (const auto& n : function->get_ordered_ops())
+    {
+        if (!needs_lowering(n))
+        {
+            continue;
+        }
+
+        // Multi-output ops would need every GetOutputElement consumer rewritten as well;
+        // none of the ops that currently do so have half-precision kernels to begin with.
+        if (n->get_output_size() != 1)
+        {
+            throw ngraph_error("Reduced precision lowering does not support multi-output op " +
+                               n->get_name());
+        }
+
+        NodeVector new_args;
+        for (auto arg : n->get_arguments())
+        {
+            if (is_reduced_precision(arg->get_element_type()))
+            {
+                new_args.push_back(std::make_shared<op::Convert>(arg, element::f32));
+            }
+            else
+            {
+                new_args.push_back(arg);
+            }
+        }
+
+        std::shared_ptr<Node> replacement = n->copy_with_new_args(new_args);
+        if (replacement->get_element_type() != n->get_element_type())
+        {
+            replacement = std::make_shared<op::Convert>(replacement, n->get_element_type());
+        }
+
+        ngraph::replace_node(n, replacement);
+        clobbered = true;
+    }
+
+    return clobbered;
+}
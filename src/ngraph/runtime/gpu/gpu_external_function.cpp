@@ -106,6 +106,7 @@
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
+#include "ngraph/pass/implicit_broadcast_elimination.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
@@ -304,6 +305,8 @@ void runtime::gpu::GPU_ExternalFunction::compile()
 
     pass::Manager pass_manager;
     // pass_manager.register_pass<pass::TopologicalSort>();
+    // The GPU kernels expect same-shaped arguments
+    pass_manager.register_pass<pass::ImplicitBroadcastElimination>();
     // For now, just make everyone row-major.
     pass_manager.register_pass<pass::AssignLayout<descriptor::layout::DenseTensorViewLayout>>();
     pass_manager.register_pass<pass::Liveness>();
@@ -14,12 +14,16 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_view_layout.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
 #include "ngraph/pass/assign_layout.hpp"
+#include "ngraph/pass/broadcast_absorption.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/util.hpp"
@@ -54,6 +58,8 @@ bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
     {
         instance.m_is_compiled = true;
         pass::Manager pass_manager;
+        pass_manager.register_pass<pass::BroadcastAbsorption>();
+        pass_manager.register_pass<pass::ConstantFolding>();
         pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
         pass_manager.register_pass<pass::Liveness>();
         pass_manager.run_passes(function);
@@ -99,6 +105,11 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
             descriptor::TensorView* tv = param->get_output_tensor_view(i).get();
             tensor_map.insert({tv, func_inputs[input_count++]});
         }
+        if (instance.m_activation_ranges_enabled && param->get_output_size() == 1)
+        {
+            descriptor::TensorView* tv = param->get_output_tensor_view(0).get();
+            record_activation_range(instance, param.get(), tensor_map.at(tv));
+        }
     }
 
     // map function outputs -> HostTensorView
@@ -183,6 +194,11 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             perform_nan_check(op_outputs, op.get());
         }
+        if (instance.m_activation_ranges_enabled && op_outputs.size() == 1 &&
+            !op->is_constant())
+        {
+            record_activation_range(instance, op.get(), op_outputs[0]);
+        }
 
         // delete any obsolete tensors
         for (const descriptor::Tensor* t : op->liveness_free_list)
@@ -211,6 +227,10 @@ void runtime::interpreter::INTBackend::generate_calls(
     {
         op_engine<char>(op, outputs, inputs);
     }
+    else if (type == element::f16 || type == element::bf16)
+    {
+        generate_reduced_precision_calls(op, outputs, inputs);
+    }
     else if (type == element::f32)
     {
         op_engine<float>(op, outputs, inputs);
@@ -259,6 +279,108 @@ void runtime::interpreter::INTBackend::generate_calls(
     }
 }
 
+static bool is_reduced_precision(const element::Type& type)
+{
+    return type == element::f16 || type == element::bf16;
+}
+
+static void reduced_precision_to_f32(runtime::HostTensorView& src, runtime::HostTensorView& dst)
+{
+    if (src.get_element_type() == element::f16)
+    {
+        runtime::reference::convert(
+            src.get_data_ptr<float16>(), dst.get_data_ptr<float>(), src.get_element_count());
+    }
+    else
+    {
+        runtime::reference::convert(
+            src.get_data_ptr<bfloat16>(), dst.get_data_ptr<float>(), src.get_element_count());
+    }
+}
+
+static void f32_to_reduced_precision(runtime::HostTensorView& src, runtime::HostTensorView& dst)
+{
+    if (dst.get_element_type() == element::f16)
+    {
+        runtime::reference::convert(
+            src.get_data_ptr<float>(), dst.get_data_ptr<float16>(), src.get_element_count());
+    }
+    else
+    {
+        runtime::reference::convert(
+            src.get_data_ptr<float>(), dst.get_data_ptr<bfloat16>(), src.get_element_count());
+    }
+}
+
+// f16 and bf16 are storage formats. Inputs are widened to f32, the f32 kernel runs and the
+// results are narrowed back, so the reference kernels never need a half precision instantiation.
+void runtime::interpreter::INTBackend::generate_reduced_precision_calls(
+    Node& op,
+    const vector<shared_ptr<HostTensorView>>& outputs,
+    const vector<shared_ptr<HostTensorView>>& inputs)
+{
+    const string& node_op = op.description();
+    if (node_op == "Constant")
+    {
+        const op::Constant* c = static_cast<const op::Constant*>(&op);
+        memcpy(outputs[0]->get_data_ptr(),
+               c->get_data_ptr(),
+               outputs[0]->get_element_count() * outputs[0]->get_element_type().size());
+        return;
+    }
+    if (node_op == "FunctionCall" || node_op == "Reduce" || node_op == "ReduceWindow" ||
+        node_op == "SelectAndScatter")
+    {
+        throw ngraph_error("reduced precision is not supported for op " + node_op);
+    }
+
+    vector<shared_ptr<HostTensorView>> f32_inputs;
+    for (const shared_ptr<HostTensorView>& tv : inputs)
+    {
+        if (is_reduced_precision(tv->get_element_type()))
+        {
+            auto f32_tv = make_shared<HostTensorView>(element::f32, tv->get_shape(), "f32_input");
+            reduced_precision_to_f32(*tv, *f32_tv);
+            f32_inputs.push_back(f32_tv);
+        }
+        else
+        {
+            f32_inputs.push_back(tv);
+        }
+    }
+
+    // Convert writes its declared output type itself
+    bool widen_outputs = (node_op != "Convert");
+    vector<shared_ptr<HostTensorView>> f32_outputs;
+    for (const shared_ptr<HostTensorView>& tv : outputs)
+    {
+        if (widen_outputs && is_reduced_precision(tv->get_element_type()))
+        {
+            f32_outputs.push_back(
+                make_shared<HostTensorView>(element::f32, tv->get_shape(), "f32_output"));
+        }
+        else
+        {
+            f32_outputs.push_back(tv);
+        }
+    }
+
+    op_engine<float>(op, f32_outputs, f32_inputs);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (f32_outputs[i] != outputs[i])
+        {
+            f32_to_reduced_precision(*f32_outputs[i], *outputs[i]);
+        }
+    }
+}
+
+void runtime::interpreter::INTBackend::remove_compiled_function(shared_ptr<Function> func)
+{
+    m_function_map.erase(func);
+}
+
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
 {
     FunctionInstance& instance = m_function_map[func];
@@ -286,6 +408,45 @@ vector<runtime::PerformanceCounter>
     return rc;
 }
 
+void runtime::interpreter::INTBackend::enable_activation_ranges(shared_ptr<Function> func,
+                                                                bool enable)
+{
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_activation_ranges_enabled = enable;
+    instance.m_activation_ranges.clear();
+}
+
+vector<runtime::ActivationRange>
+    runtime::interpreter::INTBackend::get_activation_ranges(shared_ptr<Function> func) const
+{
+    vector<runtime::ActivationRange> rc;
+    const FunctionInstance& instance = m_function_map.at(func);
+    for (const auto& p : instance.m_activation_ranges)
+    {
+        rc.push_back(p.second);
+    }
+    return rc;
+}
+
+void runtime::interpreter::INTBackend::record_activation_range(
+    FunctionInstance& instance, const Node* op, const shared_ptr<HostTensorView>& tv)
+{
+    if (tv->get_tensor().get_element_type() != element::f32 || tv->get_element_count() == 0)
+    {
+        return;
+    }
+    const float* data = tv->get_data_ptr<float>();
+    auto range = minmax_element(data, data + tv->get_element_count());
+    auto it = instance.m_activation_ranges.find(op);
+    if (it == instance.m_activation_ranges.end())
+    {
+        it = instance.m_activation_ranges
+                 .insert({op, ActivationRange(op->get_name(), *range.first, *range.second, 0)})
+                 .first;
+    }
+    it->second.update(*range.first, *range.second);
+}
+
 void runtime::interpreter::INTBackend::perform_nan_check(
     const vector<shared_ptr<HostTensorView>>& tvs, const Node* op)
 {
@@ -31,6 +31,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max.hpp"
@@ -39,6 +40,7 @@
 #include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/replace_slice.hpp"
@@ -48,7 +50,9 @@
 #include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sum.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
 
 #include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
@@ -68,6 +72,7 @@
 #include "ngraph/runtime/reference/copy.hpp"
 #include "ngraph/runtime/reference/cos.hpp"
 #include "ngraph/runtime/reference/cosh.hpp"
+#include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
@@ -92,6 +97,7 @@
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -107,6 +113,7 @@
 #include "ngraph/runtime/reference/sinh.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
 #include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/softmax_cross_entropy.hpp"
 #include "ngraph/runtime/reference/sqrt.hpp"
 #include "ngraph/runtime/reference/subtract.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
@@ -142,12 +149,18 @@ public:
               const std::vector<std::shared_ptr<TensorView>>& outputs,
               const std::vector<std::shared_ptr<TensorView>>& intputs) override;
 
+    void remove_compiled_function(std::shared_ptr<Function> func) override;
+
     void set_nan_check(std::shared_ptr<Function> func, bool);
 
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
     std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const override;
 
+    void enable_activation_ranges(std::shared_ptr<Function> func, bool enable) override;
+    std::vector<ActivationRange>
+        get_activation_ranges(std::shared_ptr<Function> func) const override;
+
 private:
     class FunctionInstance
     {
@@ -156,17 +169,28 @@ private:
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
+        bool m_activation_ranges_enabled = false;
+        std::unordered_map<const Node*, ActivationRange> m_activation_ranges;
     };
     std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensorView>>&,
                                   const Node* op = nullptr);
 
+    static void record_activation_range(FunctionInstance& instance,
+                                        const Node* op,
+                                        const std::shared_ptr<HostTensorView>& tv);
+
     void generate_calls(const element::Type& type,
                         Node& op,
                         const std::vector<std::shared_ptr<HostTensorView>>& outputs,
                         const std::vector<std::shared_ptr<HostTensorView>>& inputs);
 
+    void generate_reduced_precision_calls(
+        Node& op,
+        const std::vector<std::shared_ptr<HostTensorView>>& outputs,
+        const std::vector<std::shared_ptr<HostTensorView>>& inputs);
+
     template <typename T>
     void op_engine(Node& node,
                    const std::vector<std::shared_ptr<HostTensorView>>& out,
@@ -185,10 +209,13 @@ private:
         }
         else if (node_op == "Add")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::add<T>(args[0]->get_data_ptr<T>(),
                               args[1]->get_data_ptr<T>(),
                               out[0]->get_data_ptr<T>(),
-                              out[0]->get_element_count());
+                              node.get_input_shape(0),
+                              node.get_input_shape(1),
+                              binop->get_autob());
         }
 #ifdef NGRAPH_DISTRIBUTED
         else if (node_op == "AllReduce")
@@ -201,10 +228,13 @@ private:
 #endif
         else if (node_op == "And")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::logical_and(args[0]->get_data_ptr<char>(),
                                    args[1]->get_data_ptr<char>(),
                                    out[0]->get_data_ptr<char>(),
-                                   out[0]->get_element_count());
+                                   node.get_input_shape(0),
+                                   node.get_input_shape(1),
+                                   binop->get_autob());
         }
         else if (node_op == "Asin")
         {
@@ -327,6 +357,18 @@ private:
                                       out[0]->get_data_ptr<char>(),
                                       out[0]->get_element_count());
             }
+            else if (type == element::f16)
+            {
+                reference::convert<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<float16>(),
+                                      out[0]->get_element_count());
+            }
+            else if (type == element::bf16)
+            {
+                reference::convert<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<bfloat16>(),
+                                      out[0]->get_element_count());
+            }
             else if (type == element::f32)
             {
                 reference::convert<T>(args[0]->get_data_ptr<T>(),
@@ -471,12 +513,50 @@ private:
             reference::cosh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
         }
+        else if (node_op == "Dequantize")
+        {
+            const op::Dequantize* dequantize = static_cast<const op::Dequantize*>(&node);
+            element::Type type = node.get_input_element_type(0);
+            if (type == element::u8)
+            {
+                reference::dequantize<uint8_t, T>(args[0]->get_data_ptr<uint8_t>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  out[0]->get_element_count(),
+                                                  dequantize->get_scale(),
+                                                  dequantize->get_zero_point());
+            }
+            else if (type == element::i8)
+            {
+                reference::dequantize<int8_t, T>(args[0]->get_data_ptr<int8_t>(),
+                                                 out[0]->get_data_ptr<T>(),
+                                                 out[0]->get_element_count(),
+                                                 dequantize->get_scale(),
+                                                 dequantize->get_zero_point());
+            }
+            else if (type == element::i32)
+            {
+                reference::dequantize<int32_t, T>(args[0]->get_data_ptr<int32_t>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  out[0]->get_element_count(),
+                                                  dequantize->get_scale(),
+                                                  dequantize->get_zero_point());
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "unsupported element type " << type << " op Dequantize";
+                throw std::runtime_error(ss.str());
+            }
+        }
         else if (node_op == "Divide")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::divide<T>(args[0]->get_data_ptr<T>(),
                                  args[1]->get_data_ptr<T>(),
                                  out[0]->get_data_ptr<T>(),
-                                 out[0]->get_element_count());
+                                 node.get_input_shape(0),
+                                 node.get_input_shape(1),
+                                 binop->get_autob());
         }
         else if (node_op == "Dot")
         {
@@ -493,10 +573,13 @@ private:
 
         else if (node_op == "Equal")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::equal<T>(args[0]->get_data_ptr<T>(),
                                 args[1]->get_data_ptr<T>(),
                                 out[0]->get_data_ptr<char>(),
-                                out[0]->get_element_count());
+                                node.get_input_shape(0),
+                                node.get_input_shape(1),
+                                binop->get_autob());
         }
         else if (node_op == "Exp")
         {
@@ -528,31 +611,43 @@ private:
         }
         else if (node_op == "Greater")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::greater<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<char>(),
-                                  out[0]->get_element_count());
+                                  node.get_input_shape(0),
+                                  node.get_input_shape(1),
+                                  binop->get_autob());
         }
         else if (node_op == "GreaterEq")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::greater_eq<T>(args[0]->get_data_ptr<T>(),
                                      args[1]->get_data_ptr<T>(),
                                      out[0]->get_data_ptr<char>(),
-                                     out[0]->get_element_count());
+                                     node.get_input_shape(0),
+                                     node.get_input_shape(1),
+                                     binop->get_autob());
         }
         else if (node_op == "Less")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::less<T>(args[0]->get_data_ptr<T>(),
                                args[1]->get_data_ptr<T>(),
                                out[0]->get_data_ptr<char>(),
-                               out[0]->get_element_count());
+                               node.get_input_shape(0),
+                               node.get_input_shape(1),
+                               binop->get_autob());
         }
         else if (node_op == "LessEq")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::less_eq<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<char>(),
-                                  out[0]->get_element_count());
+                                  node.get_input_shape(0),
+                                  node.get_input_shape(1),
+                                  binop->get_autob());
         }
         else if (node_op == "Log")
         {
@@ -570,10 +665,13 @@ private:
         }
         else if (node_op == "Maximum")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::maximum<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
-                                  out[0]->get_element_count());
+                                  node.get_input_shape(0),
+                                  node.get_input_shape(1),
+                                  binop->get_autob());
         }
         else if (node_op == "MaxPool")
         {
@@ -613,17 +711,23 @@ private:
         }
         else if (node_op == "Minimum")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::minimum<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
-                                  out[0]->get_element_count());
+                                  node.get_input_shape(0),
+                                  node.get_input_shape(1),
+                                  binop->get_autob());
         }
         else if (node_op == "Multiply")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::multiply<T>(args[0]->get_data_ptr<T>(),
                                    args[1]->get_data_ptr<T>(),
                                    out[0]->get_data_ptr<T>(),
-                                   out[0]->get_element_count());
+                                   node.get_input_shape(0),
+                                   node.get_input_shape(1),
+                                   binop->get_autob());
         }
         else if (node_op == "Negative")
         {
@@ -638,10 +742,13 @@ private:
         }
         else if (node_op == "NotEqual")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::not_equal<T>(args[0]->get_data_ptr<T>(),
                                     args[1]->get_data_ptr<T>(),
                                     out[0]->get_data_ptr<char>(),
-                                    out[0]->get_element_count());
+                                    node.get_input_shape(0),
+                                    node.get_input_shape(1),
+                                    binop->get_autob());
         }
         else if (node_op == "OneHot")
         {
@@ -654,10 +761,13 @@ private:
         }
         else if (node_op == "Or")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::logical_or(args[0]->get_data_ptr<char>(),
                                   args[1]->get_data_ptr<char>(),
                                   out[0]->get_data_ptr<char>(),
-                                  out[0]->get_element_count());
+                                  node.get_input_shape(0),
+                                  node.get_input_shape(1),
+                                  binop->get_autob());
         }
         else if (node_op == "Parameter")
         {
@@ -677,10 +787,13 @@ private:
         }
         else if (node_op == "Power")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::power<T>(args[0]->get_data_ptr<T>(),
                                 args[1]->get_data_ptr<T>(),
                                 out[0]->get_data_ptr<T>(),
-                                out[0]->get_element_count());
+                                node.get_input_shape(0),
+                                node.get_input_shape(1),
+                                binop->get_autob());
         }
         else if (node_op == "Product")
         {
@@ -691,6 +804,15 @@ private:
                                   out[0]->get_shape(),
                                   product->get_reduction_axes());
         }
+        else if (node_op == "Quantize")
+        {
+            const op::Quantize* quantize = static_cast<const op::Quantize*>(&node);
+            reference::quantize<float, T>(args[0]->get_data_ptr<float>(),
+                                          out[0]->get_data_ptr<T>(),
+                                          out[0]->get_element_count(),
+                                          quantize->get_scale(),
+                                          quantize->get_zero_point());
+        }
         else if (node_op == "Reduce")
         {
             op::Reduce* reduce = dynamic_cast<op::Reduce*>(&node);
@@ -901,6 +1023,25 @@ private:
                                   out[0]->get_shape(),
                                   softmax->get_axes());
         }
+        else if (node_op == "SoftmaxCrossEntropy")
+        {
+            auto softmax_cross_entropy = static_cast<const op::SoftmaxCrossEntropy*>(&node);
+            reference::softmax_cross_entropy<T>(args[0]->get_data_ptr<T>(),
+                                                args[1]->get_data_ptr<T>(),
+                                                out[0]->get_data_ptr<T>(),
+                                                args[0]->get_shape(),
+                                                softmax_cross_entropy->get_axes());
+        }
+        else if (node_op == "SoftmaxCrossEntropyBackprop")
+        {
+            auto backprop = static_cast<const op::SoftmaxCrossEntropyBackprop*>(&node);
+            reference::softmax_cross_entropy_backprop<T>(args[0]->get_data_ptr<T>(),
+                                                         args[1]->get_data_ptr<T>(),
+                                                         args[2]->get_data_ptr<T>(),
+                                                         out[0]->get_data_ptr<T>(),
+                                                         args[0]->get_shape(),
+                                                         backprop->get_axes());
+        }
         else if (node_op == "Sqrt")
         {
             reference::sqrt<T>(
@@ -908,10 +1049,13 @@ private:
         }
         else if (node_op == "Subtract")
         {
+            auto binop = static_cast<const op::util::BinaryElementwise*>(&node);
             reference::subtract<T>(args[0]->get_data_ptr<T>(),
                                    args[1]->get_data_ptr<T>(),
                                    out[0]->get_data_ptr<T>(),
-                                   out[0]->get_element_count());
+                                   node.get_input_shape(0),
+                                   node.get_input_shape(1),
+                                   binop->get_autob());
         }
         else if (node_op == "Sum")
         {
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -32,6 +34,22 @@ namespace ngraph
                     out[i] = arg0[i] && arg1[i];
                 }
             }
+
+            static inline void logical_and(const char* arg0,
+                                           const char* arg1,
+                                           char* out,
+                                           const Shape& arg0_shape,
+                                           const Shape& arg1_shape,
+                                           op::AutoBroadcastType broadcast_spec)
+            {
+                autobroadcast_binop(arg0,
+                                    arg1,
+                                    out,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    broadcast_spec,
+                                    [](char x, char y) -> char { return x && y; });
+            }
         }
     }
 }
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Applies \p elementwise_functor to every pair of elements of two tensors,
+            ///        reading inputs of differing shapes through numpy-style broadcasting.
+            ///
+            /// Broadcast dimensions are read with a zero stride, so a broadcast input is never
+            /// materialized at the output shape.
+            template <typename T, typename U, typename Functor>
+            void autobroadcast_binop(const T* arg0,
+                                     const T* arg1,
+                                     U* out,
+                                     const Shape& arg0_shape,
+                                     const Shape& arg1_shape,
+                                     op::AutoBroadcastType broadcast_spec,
+                                     Functor elementwise_functor)
+            {
+                if (arg0_shape == arg1_shape)
+                {
+                    size_t count = shape_size(arg0_shape);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = elementwise_functor(arg0[i], arg1[i]);
+                    }
+                    return;
+                }
+
+                Shape out_shape = op::util::BinaryElementwise::broadcast_shape(
+                    arg0_shape, arg1_shape, broadcast_spec);
+                size_t rank = out_shape.size();
+                if (shape_size(out_shape) == 0)
+                {
+                    return;
+                }
+
+                // Element strides of each input in the output index space; zero along
+                // broadcast dimensions.
+                std::vector<size_t> strides0(rank, 0);
+                std::vector<size_t> strides1(rank, 0);
+                size_t stride0 = 1;
+                size_t stride1 = 1;
+                for (size_t i = 0; i < rank; i++)
+                {
+                    size_t axis = rank - 1 - i;
+                    size_t d0 = i < arg0_shape.size() ? arg0_shape[arg0_shape.size() - 1 - i] : 1;
+                    size_t d1 = i < arg1_shape.size() ? arg1_shape[arg1_shape.size() - 1 - i] : 1;
+                    strides0[axis] = (d0 == 1 ? 0 : stride0);
+                    strides1[axis] = (d1 == 1 ? 0 : stride1);
+                    stride0 *= d0;
+                    stride1 *= d1;
+                }
+
+                size_t inner = out_shape[rank - 1];
+                size_t inner0 = strides0[rank - 1];
+                size_t inner1 = strides1[rank - 1];
+                size_t outer = shape_size(out_shape) / inner;
+
+                std::vector<size_t> counter(rank, 0);
+                size_t offset0 = 0;
+                size_t offset1 = 0;
+                for (size_t o = 0; o < outer; o++)
+                {
+                    for (size_t j = 0; j < inner; j++)
+                    {
+                        *out++ = elementwise_functor(arg0[offset0 + j * inner0],
+                                                     arg1[offset1 + j * inner1]);
+                    }
+                    for (size_t axis = rank - 1; axis-- > 0;)
+                    {
+                        offset0 += strides0[axis];
+                        offset1 += strides1[axis];
+                        if (++counter[axis] < out_shape[axis])
+                        {
+                            break;
+                        }
+                        offset0 -= strides0[axis] * out_shape[axis];
+                        offset1 -= strides1[axis] * out_shape[axis];
+                        counter[axis] = 0;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -20,6 +20,8 @@
 #include <stdexcept>
 #include <type_traits>
 
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -56,6 +58,40 @@ namespace ngraph
                     out[i] = arg0[i] / arg1[i];
                 }
             }
+
+            template <typename T>
+            typename std::enable_if<std::is_integral<T>::value>::type
+                divide(const T* arg0,
+                       const T* arg1,
+                       T* out,
+                       const Shape& arg0_shape,
+                       const Shape& arg1_shape,
+                       op::AutoBroadcastType broadcast_spec)
+            {
+                autobroadcast_binop(
+                    arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, [](T x, T y) -> T {
+                        if (y == 0)
+                        {
+                            throw std::domain_error("integer division by zero");
+                        }
+                        return x / y;
+                    });
+            }
+
+            template <typename T>
+            typename std::enable_if<std::is_floating_point<T>::value>::type
+                divide(const T* arg0,
+                       const T* arg1,
+                       T* out,
+                       const Shape& arg0_shape,
+                       const Shape& arg1_shape,
+                       op::AutoBroadcastType broadcast_spec)
+            {
+                autobroadcast_binop(
+                    arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, [](T x, T y) -> T {
+                        return x / y;
+                    });
+            }
         }
     }
 }
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -35,6 +37,20 @@ namespace ngraph
                     out[i] = arg0[i] <= arg1[i];
                 }
             }
+
+            template <typename T>
+            void less_eq(const T* arg0,
+                         const T* arg1,
+                         char* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         op::AutoBroadcastType broadcast_spec)
+            {
+                autobroadcast_binop(
+                    arg0, arg1, out, arg0_shape, arg1_shape, broadcast_spec, [](T x, T y) -> char {
+                        return x <= y;
+                    });
+            }
         }
     }
 }
@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename TI, typename TO>
+            void quantize(const TI* arg, TO* out, size_t count, float scale, int64_t zero_point)
+            {
+                // Clamp in double so the bounds of 32 bit output types are exact
+                const double lowest = static_cast<double>(std::numeric_limits<TO>::lowest());
+                const double highest = static_cast<double>(std::numeric_limits<TO>::max());
+                for (size_t i = 0; i < count; i++)
+                {
+                    double value =
+                        std::nearbyint(static_cast<double>(arg[i]) / scale) + zero_point;
+                    out[i] = static_cast<TO>(std::min(std::max(value, lowest), highest));
+                }
+            }
+        }
+    }
+}
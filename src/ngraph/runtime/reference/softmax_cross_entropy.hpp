@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Log-sum-exp of the logits over the axes, shifted by the maximum so exp can't
+            // overflow
+            template <typename T>
+            std::vector<T> log_sum_exp(const T* logits, const Shape& shape, const AxisSet& axes)
+            {
+                auto temp_shape = project(shape, axes);
+                std::vector<T> max_values(shape_size(temp_shape));
+                std::vector<T> sums(max_values.size(), 0);
+                max(logits, max_values.data(), shape, temp_shape, axes);
+
+                CoordinateTransform transform(shape);
+                CoordinateTransform temp_transform(temp_shape);
+                for (const Coordinate& coord : transform)
+                {
+                    size_t temp_index = temp_transform.index(project(coord, axes));
+                    sums[temp_index] +=
+                        std::exp(logits[transform.index(coord)] - max_values[temp_index]);
+                }
+                for (size_t i = 0; i < sums.size(); i++)
+                {
+                    sums[i] = max_values[i] + std::log(sums[i]);
+                }
+                return sums;
+            }
+
+            template <typename T>
+            void softmax_cross_entropy(
+                const T* logits, const T* labels, T* out, const Shape& shape, const AxisSet& axes)
+            {
+                auto temp_shape = project(shape, axes);
+                auto lse = log_sum_exp(logits, shape, axes);
+
+                CoordinateTransform transform(shape);
+                CoordinateTransform temp_transform(temp_shape);
+                for (const Coordinate& coord : temp_transform)
+                {
+                    out[temp_transform.index(coord)] = 0;
+                }
+                for (const Coordinate& coord : transform)
+                {
+                    size_t index = transform.index(coord);
+                    size_t temp_index = temp_transform.index(project(coord, axes));
+                    out[temp_index] += labels[index] * (lse[temp_index] - logits[index]);
+                }
+            }
+
+            template <typename T>
+            void softmax_cross_entropy_backprop(const T* logits,
+                                                const T* labels,
+                                                const T* delta,
+                                                T* out,
+                                                const Shape& shape,
+                                                const AxisSet& axes)
+            {
+                auto temp_shape = project(shape, axes);
+                auto lse = log_sum_exp(logits, shape, axes);
+                std::vector<T> label_sums(lse.size(), 0);
+
+                CoordinateTransform transform(shape);
+                CoordinateTransform temp_transform(temp_shape);
+                for (const Coordinate& coord : transform)
+                {
+                    size_t temp_index = temp_transform.index(project(coord, axes));
+                    label_sums[temp_index] += labels[transform.index(coord)];
+                }
+                for (const Coordinate& coord : transform)
+                {
+                    size_t index = transform.index(coord);
+                    size_t temp_index = temp_transform.index(project(coord, axes));
+                    T softmax = std::exp(logits[index] - lse[temp_index]);
+                    out[index] =
+                        delta[temp_index] * (softmax * label_sums[temp_index] - labels[index]);
+                }
+            }
+        }
+    }
+}
@@ -37,6 +37,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -64,6 +65,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -79,11 +81,13 @@
 #include "ngraph/op/sinh.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/softmax_cross_entropy.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -147,6 +151,27 @@ static element::Type read_element_type(const json& j)
     return element::Type(bitwidth, is_real, is_signed, c_type_string);
 }
 
+static json write_auto_broadcast(op::AutoBroadcastType autob)
+{
+    json j;
+    switch (autob)
+    {
+    case op::AutoBroadcastType::NONE: j = "none"; break;
+    case op::AutoBroadcastType::NUMPY: j = "numpy"; break;
+    }
+    return j;
+}
+
+static op::AutoBroadcastType read_auto_broadcast(const json& node_js)
+{
+    op::AutoBroadcastType autob = op::AutoBroadcastType::NONE;
+    if (node_js.count("autob") != 0 && node_js.at("autob").get<string>() == "numpy")
+    {
+        autob = op::AutoBroadcastType::NUMPY;
+    }
+    return autob;
+}
+
 void ngraph::serialize(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
 {
     ofstream out(path);
@@ -373,7 +398,7 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Add")
             {
-                node = make_shared<op::Add>(args[0], args[1]);
+                node = make_shared<op::Add>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "AllReduce")
             {
@@ -381,7 +406,7 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "And")
             {
-                node = make_shared<op::And>(args[0], args[1]);
+                node = make_shared<op::And>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Asin")
             {
@@ -576,9 +601,15 @@ static shared_ptr<ngraph::Function>
             {
                 node = make_shared<op::Cosh>(args[0]);
             }
+            else if (node_op == "Dequantize")
+            {
+                auto scale = node_js.at("scale").get<float>();
+                auto zero_point = node_js.at("zero_point").get<int64_t>();
+                node = make_shared<op::Dequantize>(args[0], scale, zero_point);
+            }
             else if (node_op == "Divide")
             {
-                node = make_shared<op::Divide>(args[0], args[1]);
+                node = make_shared<op::Divide>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Dot")
             {
@@ -596,7 +627,7 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Equal")
             {
-                node = make_shared<op::Equal>(args[0], args[1]);
+                node = make_shared<op::Equal>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Exp")
             {
@@ -618,19 +649,19 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Greater")
             {
-                node = make_shared<op::Greater>(args[0], args[1]);
+                node = make_shared<op::Greater>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "GreaterEq")
             {
-                node = make_shared<op::GreaterEq>(args[0], args[1]);
+                node = make_shared<op::GreaterEq>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Less")
             {
-                node = make_shared<op::Less>(args[0], args[1]);
+                node = make_shared<op::Less>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "LessEq")
             {
-                node = make_shared<op::LessEq>(args[0], args[1]);
+                node = make_shared<op::LessEq>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Log")
             {
@@ -691,7 +722,7 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Maximum")
             {
-                node = make_shared<op::Maximum>(args[0], args[1]);
+                node = make_shared<op::Maximum>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Min")
             {
@@ -700,11 +731,11 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Minimum")
             {
-                node = make_shared<op::Minimum>(args[0], args[1]);
+                node = make_shared<op::Minimum>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Multiply")
             {
-                node = make_shared<op::Multiply>(args[0], args[1]);
+                node = make_shared<op::Multiply>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Negative")
             {
@@ -712,7 +743,7 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "NotEqual")
             {
-                node = make_shared<op::NotEqual>(args[0], args[1]);
+                node = make_shared<op::NotEqual>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Not")
             {
@@ -726,7 +757,7 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Or")
             {
-                node = make_shared<op::Or>(args[0], args[1]);
+                node = make_shared<op::Or>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Pad")
             {
@@ -747,13 +778,20 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Power")
             {
-                node = make_shared<op::Power>(args[0], args[1]);
+                node = make_shared<op::Power>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Product")
             {
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
                 node = make_shared<op::Product>(args[0], reduction_axes);
             }
+            else if (node_op == "Quantize")
+            {
+                auto scale = node_js.at("scale").get<float>();
+                auto zero_point = node_js.at("zero_point").get<int64_t>();
+                auto target_type = read_element_type(node_js.at("target_type"));
+                node = make_shared<op::Quantize>(args[0], scale, zero_point, target_type);
+            }
             else if (node_op == "Reduce")
             {
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
@@ -853,13 +891,24 @@ static shared_ptr<ngraph::Function>
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
                 node = make_shared<op::Softmax>(args[0], reduction_axes);
             }
+            else if (node_op == "SoftmaxCrossEntropy")
+            {
+                auto axes = node_js.at("axes").get<set<size_t>>();
+                node = make_shared<op::SoftmaxCrossEntropy>(args[0], args[1], axes);
+            }
+            else if (node_op == "SoftmaxCrossEntropyBackprop")
+            {
+                auto axes = node_js.at("axes").get<set<size_t>>();
+                node =
+                    make_shared<op::SoftmaxCrossEntropyBackprop>(args[0], args[1], args[2], axes);
+            }
             else if (node_op == "Sqrt")
             {
                 node = make_shared<op::Sqrt>(args[0]);
             }
             else if (node_op == "Subtract")
             {
-                node = make_shared<op::Subtract>(args[0], args[1]);
+                node = make_shared<op::Subtract>(args[0], args[1], read_auto_broadcast(node_js));
             }
             else if (node_op == "Sum")
             {
@@ -970,6 +1019,14 @@ static json write(const Node& n, bool binary_constant_data)
         node["output_shapes"] = output_shapes;
     }
 
+    if (auto binop = dynamic_cast<const op::util::BinaryElementwise*>(&n))
+    {
+        if (binop->get_autob() != op::AutoBroadcastType::NONE)
+        {
+            node["autob"] = write_auto_broadcast(binop->get_autob());
+        }
+    }
+
     string node_op = n.description();
     if (node_op == "Abs")
     {
@@ -1083,6 +1140,12 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Cosh")
     {
     }
+    else if (node_op == "Dequantize")
+    {
+        auto tmp = dynamic_cast<const op::Dequantize*>(&n);
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+    }
     else if (node_op == "Divide")
     {
     }
@@ -1195,6 +1258,13 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Power")
     {
     }
+    else if (node_op == "Quantize")
+    {
+        auto tmp = dynamic_cast<const op::Quantize*>(&n);
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+        node["target_type"] = write_element_type(tmp->get_quantize_element_type());
+    }
     else if (node_op == "Reduce")
     {
         auto tmp = dynamic_cast<const op::Reduce*>(&n);
@@ -1265,6 +1335,16 @@ static json write(const Node& n, bool binary_constant_data)
         node["upper_bounds"] = tmp->get_upper_bounds();
         node["strides"] = tmp->get_strides();
     }
+    else if (node_op == "SoftmaxCrossEntropy")
+    {
+        auto tmp = dynamic_cast<const op::SoftmaxCrossEntropy*>(&n);
+        node["axes"] = tmp->get_axes();
+    }
+    else if (node_op == "SoftmaxCrossEntropyBackprop")
+    {
+        auto tmp = dynamic_cast<const op::SoftmaxCrossEntropyBackprop*>(&n);
+        node["axes"] = tmp->get_axes();
+    }
     else if (node_op == "Sqrt")
     {
     }
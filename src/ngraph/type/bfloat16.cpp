@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+#include "ngraph/type/bfloat16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static uint16_t f32_to_bf16_bits(float value)
+{
+    uint32_t x;
+    memcpy(&x, &value, sizeof(x));
+
+    if (std::isnan(value))
+    {
+        // Keep the sign and force a quiet NaN so truncation can't turn it into Inf
+        return static_cast<uint16_t>((x >> 16) | 0x0040);
+    }
+
+    // Round to nearest even
+    uint32_t rounding_bias = 0x7FFF + ((x >> 16) & 1);
+    return static_cast<uint16_t>((x + rounding_bias) >> 16);
+}
+
+bfloat16::bfloat16(float value)
+    : m_value{f32_to_bf16_bits(value)}
+{
+}
+
+bfloat16::operator float() const
+{
+    uint32_t x = static_cast<uint32_t>(m_value) << 16;
+    float value;
+    memcpy(&value, &x, sizeof(value));
+    return value;
+}
+
+string bfloat16::to_string() const
+{
+    stringstream ss;
+    ss << static_cast<float>(*this);
+    return ss.str();
+}
+
+bfloat16& bfloat16::operator+=(float rhs)
+{
+    *this = static_cast<float>(*this) + rhs;
+    return *this;
+}
+
+bfloat16& bfloat16::operator-=(float rhs)
+{
+    *this = static_cast<float>(*this) - rhs;
+    return *this;
+}
+
+bfloat16& bfloat16::operator*=(float rhs)
+{
+    *this = static_cast<float>(*this) * rhs;
+    return *this;
+}
+
+bfloat16& bfloat16::operator/=(float rhs)
+{
+    *this = static_cast<float>(*this) / rhs;
+    return *this;
+}
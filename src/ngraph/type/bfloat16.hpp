@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace ngraph
+{
+    /// \brief Brain floating point (s1, e8, m7) storage type, the upper half of an f32.
+    ///
+    /// bfloat16 is a storage format only. Arithmetic is performed by converting to float, so
+    /// kernels read and write bfloat16 but compute in f32.
+    class bfloat16
+    {
+    public:
+        constexpr bfloat16()
+            : m_value{0}
+        {
+        }
+
+        bfloat16(float value);
+
+        operator float() const;
+
+        /// \brief Constructs a bfloat16 from its raw bit pattern.
+        static constexpr bfloat16 from_bits(uint16_t bits) { return bfloat16(bits, true); }
+        uint16_t to_bits() const { return m_value; }
+        std::string to_string() const;
+
+        bfloat16& operator+=(float rhs);
+        bfloat16& operator-=(float rhs);
+        bfloat16& operator*=(float rhs);
+        bfloat16& operator/=(float rhs);
+
+    private:
+        constexpr bfloat16(uint16_t bits, bool)
+            : m_value{bits}
+        {
+        }
+
+        uint16_t m_value;
+    };
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<ngraph::bfloat16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr ngraph::bfloat16 min() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x0080);
+        }
+        static constexpr ngraph::bfloat16 max() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x7F7F);
+        }
+        static constexpr ngraph::bfloat16 lowest() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0xFF7F);
+        }
+        static constexpr int digits = 8;
+        static constexpr int digits10 = 2;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr int radix = 2;
+        static constexpr ngraph::bfloat16 epsilon() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x3C00);
+        }
+        static constexpr ngraph::bfloat16 round_error() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x3F00);
+        }
+        static constexpr int min_exponent = -125;
+        static constexpr int min_exponent10 = -37;
+        static constexpr int max_exponent = 128;
+        static constexpr int max_exponent10 = 38;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+        static constexpr bool has_signaling_NaN = true;
+        static constexpr float_denorm_style has_denorm = denorm_present;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr ngraph::bfloat16 infinity() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x7F80);
+        }
+        static constexpr ngraph::bfloat16 quiet_NaN() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x7FC0);
+        }
+        static constexpr ngraph::bfloat16 signaling_NaN() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x7FA0);
+        }
+        static constexpr ngraph::bfloat16 denorm_min() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x0001);
+        }
+        static constexpr bool is_iec559 = false;
+        static constexpr bool is_bounded = true;
+        static constexpr bool is_modulo = false;
+        static constexpr bool traps = false;
+        static constexpr bool tinyness_before = false;
+        static constexpr float_round_style round_style = round_to_nearest;
+    };
+}
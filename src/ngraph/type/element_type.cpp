@@ -21,6 +21,8 @@
 using namespace ngraph;
 
 const element::Type element::boolean(8, false, true, "char");
+const element::Type element::f16(16, true, true, "ngraph::float16");
+const element::Type element::bf16(16, true, true, "ngraph::bfloat16");
 const element::Type element::f32(32, true, true, "float");
 const element::Type element::f64(64, true, true, "double");
 const element::Type element::i8(8, false, true, "int8_t");
@@ -35,6 +37,8 @@ const element::Type element::u64(64, false, false, "uint64_t");
 std::vector<const element::Type*> element::Type::get_known_types()
 {
     std::vector<const element::Type*> rc = {&element::boolean,
+                                            &element::f16,
+                                            &element::bf16,
                                             &element::f32,
                                             &element::f64,
                                             &element::i8,
@@ -85,7 +89,8 @@ bool element::Type::operator<(const Type& other) const
     v2 |= (other.m_is_real ? 2 : 0);
     v2 |= (other.m_is_signed ? 1 : 0);
 
-    return v1 < v2;
+    // f16 and bf16 share bitwidth and flags, so fall back to the name to order them
+    return v1 < v2 || (v1 == v2 && m_cname < other.m_cname);
 }
 
 size_t element::Type::size() const
@@ -98,7 +103,8 @@ size_t element::Type::hash() const
     size_t h1 = std::hash<size_t>{}(m_bitwidth);
     size_t h2 = std::hash<bool>{}(m_is_real);
     size_t h3 = std::hash<bool>{}(m_is_signed);
-    return h1 ^ ((h2 ^ (h3 << 1)) << 1);
+    size_t h4 = std::hash<std::string>{}(m_cname);
+    return h1 ^ ((h2 ^ (h3 << 1)) << 1) ^ (h4 << 2);
 }
 
 namespace ngraph
@@ -116,6 +122,16 @@ namespace ngraph
             return boolean;
         }
         template <>
+        const Type& from<ngraph::float16>()
+        {
+            return f16;
+        }
+        template <>
+        const Type& from<ngraph::bfloat16>()
+        {
+            return bf16;
+        }
+        template <>
         const Type& from<float>()
         {
             return f32;
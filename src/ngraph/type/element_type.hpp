@@ -26,6 +26,8 @@
 #include <vector>
 
 #include "ngraph/except.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 namespace ngraph
 {
@@ -34,6 +36,8 @@ namespace ngraph
         class Type;
 
         extern const Type boolean;
+        extern const Type f16;
+        extern const Type bf16;
         extern const Type f32;
         extern const Type f64;
         extern const Type i8;
@@ -84,6 +88,10 @@ namespace ngraph
         template <>
         const Type& from<bool>();
         template <>
+        const Type& from<ngraph::float16>();
+        template <>
+        const Type& from<ngraph::bfloat16>();
+        template <>
         const Type& from<float>();
         template <>
         const Type& from<double>();
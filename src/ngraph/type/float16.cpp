@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <sstream>
+
+#include "ngraph/type/float16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static uint16_t f32_to_f16_bits(float value)
+{
+    uint32_t x;
+    memcpy(&x, &value, sizeof(x));
+
+    uint32_t sign = (x >> 16) & 0x8000;
+    uint32_t exponent = (x >> 23) & 0xFF;
+    uint32_t mantissa = x & 0x7FFFFF;
+
+    if (exponent == 0xFF)
+    {
+        // Inf stays Inf, NaN stays a (quiet) NaN
+        return static_cast<uint16_t>(sign | 0x7C00 | (mantissa ? 0x0200 | (mantissa >> 13) : 0));
+    }
+
+    int32_t half_exponent = static_cast<int32_t>(exponent) - 127 + 15;
+    if (half_exponent >= 0x1F)
+    {
+        // Too large for f16, saturate to Inf
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+
+    if (half_exponent <= 0)
+    {
+        // Result is a subnormal f16 or zero
+        if (half_exponent < -10)
+        {
+            return static_cast<uint16_t>(sign);
+        }
+        mantissa |= 0x800000;
+        uint32_t shift = static_cast<uint32_t>(14 - half_exponent);
+        uint32_t half_mantissa = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half_mantissa & 1)))
+        {
+            half_mantissa++;
+        }
+        return static_cast<uint16_t>(sign | half_mantissa);
+    }
+
+    // Round to nearest even; a carry out of the mantissa correctly bumps the exponent
+    uint32_t half = sign | (static_cast<uint32_t>(half_exponent) << 10) | (mantissa >> 13);
+    uint32_t remainder = mantissa & 0x1FFF;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+    {
+        half++;
+    }
+    return static_cast<uint16_t>(half);
+}
+
+static float f16_bits_to_f32(uint16_t half)
+{
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x3FF;
+    uint32_t x;
+
+    if (exponent == 0x1F)
+    {
+        x = sign | 0x7F800000 | (mantissa << 13);
+    }
+    else if (exponent == 0)
+    {
+        if (mantissa == 0)
+        {
+            x = sign;
+        }
+        else
+        {
+            // Normalize the f16 subnormal into an f32 normal
+            int32_t normalized_exponent = 1;
+            while ((mantissa & 0x400) == 0)
+            {
+                mantissa <<= 1;
+                normalized_exponent--;
+            }
+            mantissa &= 0x3FF;
+            x = sign | (static_cast<uint32_t>(normalized_exponent + 112) << 23) | (mantissa << 13);
+        }
+    }
+    else
+    {
+        x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+
+    float value;
+    memcpy(&value, &x, sizeof(value));
+    return value;
+}
+
+float16::float16(float value)
+    : m_value{f32_to_f16_bits(value)}
+{
+}
+
+float16::operator float() const
+{
+    return f16_bits_to_f32(m_value);
+}
+
+string float16::to_string() const
+{
+    stringstream ss;
+    ss << static_cast<float>(*this);
+    return ss.str();
+}
+
+float16& float16::operator+=(float rhs)
+{
+    *this = static_cast<float>(*this) + rhs;
+    return *this;
+}
+
+float16& float16::operator-=(float rhs)
+{
+    *this = static_cast<float>(*this) - rhs;
+    return *this;
+}
+
+float16& float16::operator*=(float rhs)
+{
+    *this = static_cast<float>(*this) * rhs;
+    return *this;
+}
+
+float16& float16::operator/=(float rhs)
+{
+    *this = static_cast<float>(*this) / rhs;
+    return *this;
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace ngraph
+{
+    /// \brief IEEE 754 half precision (s1, e5, m10) floating point storage type.
+    ///
+    /// float16 is a storage format only. Arithmetic is performed by converting to float, so
+    /// kernels read and write float16 but compute in f32.
+    class float16
+    {
+    public:
+        constexpr float16()
+            : m_value{0}
+        {
+        }
+
+        float16(float value);
+
+        operator float() const;
+
+        /// \brief Constructs a float16 from its raw bit pattern.
+        static constexpr float16 from_bits(uint16_t bits) { return float16(bits, true); }
+        uint16_t to_bits() const { return m_value; }
+        std::string to_string() const;
+
+        float16& operator+=(float rhs);
+        float16& operator-=(float rhs);
+        float16& operator*=(float rhs);
+        float16& operator/=(float rhs);
+
+    private:
+        constexpr float16(uint16_t bits, bool)
+            : m_value{bits}
+        {
+        }
+
+        uint16_t m_value;
+    };
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<ngraph::float16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr ngraph::float16 min() noexcept
+        {
+            return ngraph::float16::from_bits(0x0400);
+        }
+        static constexpr ngraph::float16 max() noexcept
+        {
+            return ngraph::float16::from_bits(0x7BFF);
+        }
+        static constexpr ngraph::float16 lowest() noexcept
+        {
+            return ngraph::float16::from_bits(0xFBFF);
+        }
+        static constexpr int digits = 11;
+        static constexpr int digits10 = 3;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr int radix = 2;
+        static constexpr ngraph::float16 epsilon() noexcept
+        {
+            return ngraph::float16::from_bits(0x1400);
+        }
+        static constexpr ngraph::float16 round_error() noexcept
+        {
+            return ngraph::float16::from_bits(0x3800);
+        }
+        static constexpr int min_exponent = -13;
+        static constexpr int min_exponent10 = -4;
+        static constexpr int max_exponent = 16;
+        static constexpr int max_exponent10 = 4;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+        static constexpr bool has_signaling_NaN = true;
+        static constexpr float_denorm_style has_denorm = denorm_present;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr ngraph::float16 infinity() noexcept
+        {
+            return ngraph::float16::from_bits(0x7C00);
+        }
+        static constexpr ngraph::float16 quiet_NaN() noexcept
+        {
+            return ngraph::float16::from_bits(0x7E00);
+        }
+        static constexpr ngraph::float16 signaling_NaN() noexcept
+        {
+            return ngraph::float16::from_bits(0x7D00);
+        }
+        static constexpr ngraph::float16 denorm_min() noexcept
+        {
+            return ngraph::float16::from_bits(0x0001);
+        }
+        static constexpr bool is_iec559 = true;
+        static constexpr bool is_bounded = true;
+        static constexpr bool is_modulo = false;
+        static constexpr bool traps = false;
+        static constexpr bool tinyness_before = false;
+        static constexpr float_round_style round_style = round_to_nearest;
+    };
+}
@@ -0,0 +1,256 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+// tool to calibrate int8 quantization parameters of any ngraph json model.
+// runs the model over sample inputs, records the range of every f32 activation and writes
+// a model with Quantize/Dequantize pairs inserted in front of convolutions and dots.
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/pass/calibrated_quantization.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void help()
+{
+    cout << R"###(
+DESCRIPTION
+    Calibrate int8 quantization parameters of a serialized model
+
+SYNOPSIS
+        calibrate [-f <filename>] [-o <filename>] [-b <backend>] [-i <input file>]...
+                  [-n <samples>]
+
+OPTIONS
+        -f|--file          Serialized model file
+        -o|--output        Calibrated model file (default: <file>.calibrated.json)
+        -b|--backend       Backend to use (default: INTERPRETER)
+        -i|--input         Raw sample data for the next parameter, in parameter order. Each
+                           file holds one or more consecutive samples of the parameter's
+                           tensor in its element type. Without inputs uniform random data in
+                           [0, 1) is used.
+        -n|--samples       Number of random samples when no inputs are given (default: 10)
+        -r|--ranges        Print the recorded activation ranges
+)###";
+}
+
+int main(int argc, char** argv)
+{
+    string model;
+    string output;
+    string backend_name = "INTERPRETER";
+    vector<string> input_files;
+    size_t samples = 10;
+    bool print_ranges = false;
+    bool failed = false;
+    for (size_t i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if ((arg == "-f" || arg == "--file") && i + 1 < argc)
+        {
+            model = argv[++i];
+        }
+        else if ((arg == "-o" || arg == "--output") && i + 1 < argc)
+        {
+            output = argv[++i];
+        }
+        else if ((arg == "-b" || arg == "--backend") && i + 1 < argc)
+        {
+            backend_name = argv[++i];
+        }
+        else if ((arg == "-i" || arg == "--input") && i + 1 < argc)
+        {
+            input_files.push_back(argv[++i]);
+        }
+        else if ((arg == "-n" || arg == "--samples") && i + 1 < argc)
+        {
+            try
+            {
+                samples = stoul(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "-r" || arg == "--ranges")
+        {
+            print_ranges = true;
+        }
+        else if (arg == "-h" || arg == "--help")
+        {
+            help();
+            return 0;
+        }
+        else
+        {
+            cout << "Unknown option: " << arg << endl;
+            failed = true;
+        }
+    }
+    if (!static_cast<bool>(ifstream(model)))
+    {
+        cout << "File " << model << " not found\n";
+        failed = true;
+    }
+    if (failed)
+    {
+        help();
+        return 1;
+    }
+    if (output.empty())
+    {
+        output = model + ".calibrated.json";
+    }
+
+    const string json_string = file_util::read_file_to_string(model);
+    stringstream ss(json_string);
+    shared_ptr<Function> f = deserialize(ss);
+
+    const op::ParameterVector& parameters = f->get_parameters();
+    if (!input_files.empty() && input_files.size() != parameters.size())
+    {
+        cout << "Model has " << parameters.size() << " parameters but " << input_files.size()
+             << " input files were given\n";
+        return 1;
+    }
+
+    vector<vector<char>> input_data;
+    for (size_t i = 0; i < input_files.size(); i++)
+    {
+        input_data.push_back(file_util::read_file_contents(input_files[i]));
+        size_t tensor_size = shape_size(parameters[i]->get_shape()) *
+                             parameters[i]->get_element_type().size();
+        size_t file_samples = tensor_size == 0 ? 0 : input_data[i].size() / tensor_size;
+        if (tensor_size == 0 || input_data[i].size() % tensor_size != 0)
+        {
+            cout << "Size of " << input_files[i] << " is not a multiple of parameter " << i
+                 << " size " << tensor_size << "\n";
+            return 1;
+        }
+        samples = (i == 0 ? file_samples : min(samples, file_samples));
+    }
+
+    // Backends may rewrite the function they run, so calibrate a clone and keep f pristine
+    NodeMap node_map;
+    shared_ptr<Function> calibration_function = clone_function(*f, node_map);
+
+    auto backend = runtime::Backend::create(backend_name);
+
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (shared_ptr<op::Parameter> param : calibration_function->get_parameters())
+    {
+        args.push_back(backend->create_tensor(param->get_element_type(), param->get_shape()));
+    }
+    vector<shared_ptr<runtime::TensorView>> results;
+    for (size_t i = 0; i < calibration_function->get_output_size(); i++)
+    {
+        results.push_back(
+            backend->create_tensor(calibration_function->get_output_element_type(i),
+                                   calibration_function->get_output_shape(i)));
+    }
+
+    backend->enable_activation_ranges(calibration_function, true);
+    default_random_engine engine(0);
+    uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    for (size_t sample = 0; sample < samples; sample++)
+    {
+        for (size_t i = 0; i < args.size(); i++)
+        {
+            const element::Type& type = args[i]->get_tensor().get_element_type();
+            size_t size = args[i]->get_element_count() * type.size();
+            if (!input_data.empty())
+            {
+                args[i]->write(&input_data[i][sample * size], 0, size);
+            }
+            else if (type == element::f32)
+            {
+                vector<float> data(args[i]->get_element_count());
+                for (float& value : data)
+                {
+                    value = distribution(engine);
+                }
+                args[i]->write(data.data(), 0, size);
+            }
+            else
+            {
+                vector<char> data(size, 0);
+                args[i]->write(data.data(), 0, size);
+            }
+        }
+        backend->call(calibration_function, results, args);
+    }
+
+    // Ranges are reported by the names of the clone's nodes; translate back to f
+    unordered_map<string, string> original_names;
+    for (auto& p : node_map.get_node_map())
+    {
+        original_names[p.second->get_name()] = p.first->get_name();
+    }
+    vector<runtime::ActivationRange> ranges;
+    for (const runtime::ActivationRange& range :
+         backend->get_activation_ranges(calibration_function))
+    {
+        auto it = original_names.find(range.name());
+        if (it != original_names.end())
+        {
+            ranges.emplace_back(it->second, range.min(), range.max(), range.call_count());
+        }
+    }
+    if (ranges.empty())
+    {
+        cout << "Backend " << backend_name << " does not record activation ranges\n";
+        return 1;
+    }
+    if (print_ranges)
+    {
+        sort(ranges.begin(), ranges.end(), [](const runtime::ActivationRange& a,
+                                              const runtime::ActivationRange& b) {
+            return a.name() < b.name();
+        });
+        for (const runtime::ActivationRange& range : ranges)
+        {
+            cout << setw(30) << left << range.name() << " [" << range.min() << ", "
+                 << range.max() << "]\n";
+        }
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CalibratedQuantization>(ranges);
+    pass_manager.run_passes(f);
+
+    serialize(output, f, 2);
+    cout << "Calibrated " << model << " over " << samples << " samples, wrote " << output
+         << "\n";
+
+    return 0;
+}
@@ -29,6 +29,7 @@
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/exp.hpp"
@@ -522,3 +523,49 @@ TEST(algebraic_simplification, log_no_divide)
     pass_manager.run_passes(f);
     ASSERT_EQ(neg_inner->get_argument(0), log_mul);
 }
+
+TEST(algebraic_simplification, convert_widening_round_trip)
+{
+    auto a = make_shared<op::Parameter>(element::bf16, Shape{2, 3});
+    auto widened = make_shared<op::Convert>(a, element::f32);
+    auto narrowed = make_shared<op::Convert>(widened, element::bf16);
+    auto neg = make_shared<op::Negative>(narrowed);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+
+    auto f = std::make_shared<Function>(ngraph::NodeVector{neg}, op::ParameterVector{a});
+    pass_manager.run_passes(f);
+    ASSERT_EQ(neg->get_argument(0), a);
+}
+
+TEST(algebraic_simplification, convert_narrowing_round_trip)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto narrowed = make_shared<op::Convert>(a, element::bf16);
+    auto widened = make_shared<op::Convert>(narrowed, element::f32);
+    auto neg = make_shared<op::Negative>(widened);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+
+    // Rounding to bf16 is observable, so the pair must stay
+    auto f = std::make_shared<Function>(ngraph::NodeVector{neg}, op::ParameterVector{a});
+    pass_manager.run_passes(f);
+    ASSERT_EQ(neg->get_argument(0), widened);
+    ASSERT_EQ(widened->get_argument(0), narrowed);
+}
+
+TEST(algebraic_simplification, convert_same_type)
+{
+    auto a = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto convert = make_shared<op::Convert>(a, element::i32);
+    auto neg = make_shared<op::Negative>(convert);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+
+    auto f = std::make_shared<Function>(ngraph::NodeVector{neg}, op::ParameterVector{a});
+    pass_manager.run_passes(f);
+    ASSERT_EQ(neg->get_argument(0), a);
+}
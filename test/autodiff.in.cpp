@@ -1218,6 +1218,28 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_softmax_underflow)
     EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph, {x0}, .01f, .01f));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_softmax_cross_entropy)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    test::Uniform<float> rng_labels(0.0f, 1.0f);
+    Shape shape{2, 3, 4};
+    auto x0 = rng.initialize(backend->create_tensor<float>(shape));
+    auto x1 = rng_labels.initialize(backend->create_tensor<float>(shape));
+
+    for (auto axes : {AxisSet{2}, AxisSet{0, 1}})
+    {
+        auto make_graph = [shape, axes]() {
+            auto X0 = make_shared<op::Parameter>(element::f32, shape);
+            auto X1 = make_shared<op::Parameter>(element::f32, shape);
+            return make_shared<Function>(make_shared<op::SoftmaxCrossEntropy>(X0, X1, axes),
+                                         std::vector<std::shared_ptr<op::Parameter>>{X0, X1});
+        };
+        EXPECT_TRUE(autodiff_numeric_compare<float>(backend, make_graph, {x0, x1}, .01f, .01f));
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, backwards_softmax_3d)
 {
     auto backend = runtime::Backend::create("${BACKEND_NAME}");
@@ -22,7 +22,10 @@
 #include "gtest/gtest.h"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/calibrated_quantization.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "util/all_close.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
@@ -73,3 +76,81 @@ TEST(INTERPRETER, nan_check_output)
     ibackend->set_nan_check(f, true);
     EXPECT_ANY_THROW(ibackend->call(f, {result}, {a, b}));
 }
+
+TEST(INTERPRETER, activation_ranges)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto f = make_shared<Function>(add, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->enable_activation_ranges(f, true);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{-1, 0, 0, 0});
+    backend->call(f, {result}, {a, b});
+    copy_data(a, vector<float>{0, 8, 0, 0});
+    copy_data(b, vector<float>{0, 0, 0, -3});
+    backend->call(f, {result}, {a, b});
+
+    map<string, runtime::ActivationRange> ranges;
+    for (const runtime::ActivationRange& range : backend->get_activation_ranges(f))
+    {
+        ranges[range.name()] = range;
+    }
+    ASSERT_EQ(ranges.count(A->get_name()), 1);
+    ASSERT_EQ(ranges.count(add->get_name()), 1);
+    EXPECT_EQ(ranges[A->get_name()].min(), 0);
+    EXPECT_EQ(ranges[A->get_name()].max(), 8);
+    EXPECT_EQ(ranges[B->get_name()].min(), -3);
+    EXPECT_EQ(ranges[B->get_name()].max(), 0);
+    EXPECT_EQ(ranges[add->get_name()].min(), -3);
+    EXPECT_EQ(ranges[add->get_name()].max(), 8);
+    EXPECT_EQ(ranges[add->get_name()].call_count(), 2);
+}
+
+TEST(INTERPRETER, calibrated_quantization)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto relu = make_shared<op::Relu>(A);
+    auto weights =
+        op::Constant::create(element::f32, Shape{3, 2}, {0.5f, -1.0f, 0.25f, 1.0f, -0.5f, 0.0f});
+    auto dot = make_shared<op::Dot>(relu, weights);
+    auto f = make_shared<Function>(dot, op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(a, vector<float>{1.0f, -2.0f, 2.0f, 0.5f, 1.5f, -1.0f});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+
+    backend->enable_activation_ranges(f, true);
+    backend->call(f, {result}, {a});
+    vector<float> expected = read_vector<float>(result);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CalibratedQuantization>(backend->get_activation_ranges(f));
+    pass_manager.run_passes(f);
+
+    // Relu output is non-negative so it is quantized to u8, constant weights to i8
+    ASSERT_EQ(count_ops_of_type<op::Quantize>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Dequantize>(f), 2);
+    auto data = dynamic_pointer_cast<op::Dequantize>(dot->get_argument(0));
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data->get_input_element_type(0), element::u8);
+    auto quantized_weights = dynamic_pointer_cast<op::Dequantize>(dot->get_argument(1));
+    ASSERT_NE(quantized_weights, nullptr);
+    EXPECT_EQ(quantized_weights->get_input_element_type(0), element::i8);
+
+    backend->remove_compiled_function(f);
+    backend->call(f, {result}, {a});
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result), 0.02f, 0.02f));
+}
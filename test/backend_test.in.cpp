@@ -1777,6 +1777,97 @@ NGRAPH_TEST(${BACKEND_NAME}, broadcast_vector_rowwise_reversed)
     EXPECT_EQ((vector<float>{4, 3, 2, 1, 4, 3, 2, 1, 4, 3, 2, 1}), read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, add_numpy_broadcast)
+{
+    Shape shape_a{2, 1, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{2, 1};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{2, 2, 3};
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B, op::AutoBroadcastType::NUMPY),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{10, 20});
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{11, 12, 13, 21, 22, 23, 14, 15, 16, 24, 25, 26}),
+              read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, greater_numpy_broadcast)
+{
+    Shape shape_a{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{3};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Greater>(A, B, op::AutoBroadcastType::NUMPY),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 5, 3, 4, 2, 6});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{2, 2, 4});
+    auto result = backend->create_tensor(element::boolean, shape_a);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<char>{0, 1, 0, 1, 0, 1}), read_vector<char>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, subtract_numpy_broadcast_scalar_int32)
+{
+    Shape shape_a{};
+    auto A = make_shared<op::Parameter>(element::i32, shape_a);
+    Shape shape_b{2, 2};
+    auto B = make_shared<op::Parameter>(element::i32, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Subtract>(A, B, op::AutoBroadcastType::NUMPY),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::i32, shape_a);
+    copy_data(a, vector<int32_t>{10});
+    auto b = backend->create_tensor(element::i32, shape_b);
+    copy_data(b, vector<int32_t>{1, 2, 3, 4});
+    auto result = backend->create_tensor(element::i32, shape_b);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<int32_t>{9, 8, 7, 6}), read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, multiply_broadcast_vector_colwise)
+{
+    Shape shape_a{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{2};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto broadcast = make_shared<op::Broadcast>(B, shape_a, AxisSet{1});
+    auto f = make_shared<Function>(make_shared<op::Multiply>(A, broadcast),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{10, 100});
+    auto result = backend->create_tensor(element::f32, shape_a);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{10, 20, 30, 400, 500, 600}), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, broadcast_vector_rowwise_int64)
 {
     Shape shape_a{4};
@@ -1907,6 +1998,130 @@ NGRAPH_TEST(${BACKEND_NAME}, convert_float32_bool)
     EXPECT_EQ((vector<char>{1, 2, 3, 4}), read_vector<char>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convert_float32_float16)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f =
+        make_shared<Function>(make_shared<op::Convert>(A, element::f16), op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.0f, -2.5f, 0.1f, 70000.0f});
+    auto result = backend->create_tensor(element::f16, shape);
+
+    backend->call(f, {result}, {a});
+    vector<uint16_t> expected{0x3C00, 0xC100, 0x2E66, 0x7C00};
+    vector<uint16_t> actual;
+    for (float16 value : read_vector<float16>(result))
+    {
+        actual.push_back(value.to_bits());
+    }
+    EXPECT_EQ(expected, actual);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, add_bfloat16)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::bf16, shape);
+    auto B = make_shared<op::Parameter>(element::bf16, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::bf16, shape);
+    copy_data(a, vector<bfloat16>{1.0f, 2.0f, 3.0f, 256.0f});
+    auto b = backend->create_tensor(element::bf16, shape);
+    copy_data(b, vector<bfloat16>{0.5f, -2.0f, 0.25f, 1.0f});
+    auto result = backend->create_tensor(element::bf16, shape);
+
+    backend->call(f, {result}, {a, b});
+    vector<float> actual;
+    for (bfloat16 value : read_vector<bfloat16>(result))
+    {
+        actual.push_back(value);
+    }
+    // 256 + 1 is not representable with an 8 bit significand and rounds back to 256
+    EXPECT_EQ((vector<float>{1.5f, 0.0f, 3.25f, 256.0f}), actual);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_uint8)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Quantize>(A, 0.5f, 10, element::u8),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{0.0f, 1.2f, -2.0f, -10.0f, 200.0f, 2.25f});
+    auto result = backend->create_tensor(element::u8, shape);
+
+    backend->call(f, {result}, {a});
+    // Values outside of the u8 range saturate
+    EXPECT_EQ((vector<uint8_t>{10, 12, 6, 0, 255, 14}), read_vector<uint8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_int8)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Quantize>(A, 0.1f, 0, element::i8),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-1.0f, 0.26f, 12.7f, -100.0f});
+    auto result = backend->create_tensor(element::i8, shape);
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<int8_t>{-10, 3, 127, -128}), read_vector<int8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dequantize_int8)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::i8, shape);
+    auto f = make_shared<Function>(make_shared<op::Dequantize>(A, 0.25f, -2),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::i8, shape);
+    copy_data(a, vector<int8_t>{-2, 0, 127, -128});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{0.0f, 0.5f, 32.25f, -31.5f}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_dequantize_round_trip)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto Q = make_shared<op::Quantize>(A, 0.125f, 0, element::i32);
+    auto f = make_shared<Function>(make_shared<op::Dequantize>(Q, 0.125f, 0),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.0f, -3.3f, 0.06f, 1000.5f});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{1.0f, -3.25f, 0.0f, 1000.5f}), read_vector<float>(result));
+}
+
 // Trivial case with no reduction axes.
 NGRAPH_TEST(${BACKEND_NAME}, reduce_trivial)
 {
@@ -7779,6 +7994,53 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_underflow)
     EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, softmax_cross_entropy_axis)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::SoftmaxCrossEntropy>(A, B, AxisSet{1}),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // The second row would overflow exp without the log-sum-exp shift
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 1000, 1001, 1002});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{0, 0, 1, 0.5, 0.5, 0});
+    auto result = backend->create_tensor(element::f32, Shape{2});
+
+    auto lse = logf(1 + expf(-1) + expf(-2));
+
+    backend->call(f, {result}, {a, b});
+    vector<float> expected{lse, 1.5f + lse};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, softmax_cross_entropy_axis_0)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::SoftmaxCrossEntropy>(A, B, AxisSet{0}),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-10, -20, -30, -40, -50, -60});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 0, 0, 0, 1, 1});
+    auto result = backend->create_tensor(element::f32, Shape{3});
+
+    auto lse = log1pf(expf(-30));
+
+    backend->call(f, {result}, {a, b});
+    vector<float> expected{lse, 30 + lse, 30 + lse};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, multiple_backends)
 {
     Shape shape{2, 2};
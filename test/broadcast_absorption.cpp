@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/broadcast_absorption.hpp"
+#include "ngraph/pass/implicit_broadcast_elimination.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/all_close.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Runs `f` with random arguments before and after `pass_manager` and checks the results match.
+// Copies are executed, since the backend's own passes may rewrite the graph again.
+static void run_and_compare(const shared_ptr<Function>& f, pass::Manager& pass_manager)
+{
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : f->get_parameters())
+    {
+        vector<float> arg(shape_size(param->get_shape()));
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto f_ref = clone_function(*f);
+    auto ref_results = execute(f_ref, args, "INTERPRETER");
+    pass_manager.run_passes(f);
+    auto results = execute(clone_function(*f), args, "INTERPRETER");
+    EXPECT_EQ(ref_results.size(), results.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(ref_results.at(i), results.at(i)));
+    }
+}
+
+TEST(broadcast_absorption, bias_add)
+{
+    Shape shape{2, 3, 4, 4};
+    auto data = make_shared<op::Parameter>(element::f32, shape);
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto broadcast = make_shared<op::Broadcast>(bias, shape, AxisSet{0, 2, 3});
+    auto add = make_shared<op::Add>(data, broadcast);
+    auto f = make_shared<Function>(add, op::ParameterVector{data, bias});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BroadcastAbsorption>();
+    run_and_compare(f, pass_manager);
+
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    auto new_add = dynamic_pointer_cast<op::Add>(f->get_results().at(0)->get_argument(0));
+    ASSERT_NE(new_add, nullptr);
+    EXPECT_EQ(new_add->get_autob(), op::AutoBroadcastType::NUMPY);
+    // The bias only needs trailing unit dimensions to line up with the channel axis
+    EXPECT_EQ(new_add->get_argument(1)->get_shape(), (Shape{3, 1, 1}));
+}
+
+TEST(broadcast_absorption, leading_axes)
+{
+    Shape shape{4, 3};
+    auto data = make_shared<op::Parameter>(element::f32, shape);
+    auto row = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto broadcast = make_shared<op::Broadcast>(row, shape, AxisSet{0});
+    auto mul = make_shared<op::Multiply>(broadcast, data);
+    auto f = make_shared<Function>(mul, op::ParameterVector{data, row});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BroadcastAbsorption>();
+    run_and_compare(f, pass_manager);
+
+    // Numpy already aligns trailing axes, so no Reshape is needed
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+}
+
+TEST(broadcast_absorption, both_arguments_broadcast)
+{
+    Shape shape{2, 3};
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto add = make_shared<op::Add>(make_shared<op::Broadcast>(a, shape, AxisSet{1}),
+                                    make_shared<op::Broadcast>(b, shape, AxisSet{0}));
+    auto f = make_shared<Function>(add, op::ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BroadcastAbsorption>();
+    run_and_compare(f, pass_manager);
+
+    // Absorbing both would change the shape the other side is broadcast against
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+}
+
+TEST(implicit_broadcast_elimination, explicit_broadcast)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 1, 3});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4, 1});
+    auto sub = make_shared<op::Subtract>(a, b, op::AutoBroadcastType::NUMPY);
+    auto f = make_shared<Function>(sub, op::ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ImplicitBroadcastElimination>();
+    run_and_compare(f, pass_manager);
+
+    auto new_sub = f->get_results().at(0)->get_argument(0);
+    EXPECT_EQ(new_sub->get_shape(), (Shape{2, 4, 3}));
+    EXPECT_EQ(new_sub->get_argument(0)->get_shape(), (Shape{2, 4, 3}));
+    EXPECT_EQ(new_sub->get_argument(1)->get_shape(), (Shape{2, 4, 3}));
+}
@@ -132,3 +132,64 @@ TEST(build_graph, function_undeclared_parameters)
         FAIL() << "Function construction failed for unexpected reason";
     }
 }
+
+TEST(build_graph, ordered_ops_cache)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(neg, op::ParameterVector{A, B});
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 5);
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+
+    // Rewiring the graph must invalidate the cached order
+    auto mul = make_shared<op::Multiply>(A, B);
+    replace_node(add, mul);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 5);
+    EXPECT_EQ(count(ops.begin(), ops.end(), add), 0);
+    EXPECT_LT(distance(ops.begin(), find(ops.begin(), ops.end(), mul)),
+              distance(ops.begin(), find(ops.begin(), ops.end(), neg)));
+
+    // The cache must not keep replaced nodes alive
+    weak_ptr<Node> weak_add = add;
+    add.reset();
+    EXPECT_TRUE(weak_add.expired());
+    EXPECT_EQ(A->get_users().size(), 1);
+}
+
+TEST(build_graph, ordered_ops_cache_per_function)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(make_shared<op::Add>(A, B)),
+                                   op::ParameterVector{A, B});
+
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto D = make_shared<op::Parameter>(element::f32, shape);
+    auto sub = make_shared<op::Subtract>(C, D);
+    auto g = make_shared<Function>(make_shared<op::Abs>(sub), op::ParameterVector{C, D});
+
+    const list<shared_ptr<Node>>* f_ops = &f->get_ordered_ops();
+    auto f_order = *f_ops;
+    g->get_ordered_ops();
+
+    // Editing g leaves the cached order of f untouched
+    replace_node(sub, make_shared<op::Multiply>(C, D));
+    EXPECT_EQ(g->get_ordered_ops().size(), 5);
+    EXPECT_EQ(&f->get_ordered_ops(), f_ops);
+    EXPECT_EQ(f->get_ordered_ops(), f_order);
+
+    // Editing f is still noticed
+    auto neg = f->get_results().at(0)->get_argument(0);
+    replace_node(neg->get_argument(0), make_shared<op::Multiply>(A, B));
+    auto ops = f->get_ordered_ops();
+    EXPECT_NE(ops, f_order);
+    EXPECT_EQ(count_ops_of_type<op::Multiply>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Add>(f), 0);
+}
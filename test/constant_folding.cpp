@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(constant_folding, reshape_broadcast_chain)
+{
+    auto weights = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto reshape = make_shared<op::Reshape>(weights, AxisVector{1, 0}, Shape{3, 2});
+    auto broadcast = make_shared<op::Broadcast>(reshape, Shape{2, 3, 2}, AxisSet{0});
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 2});
+    auto add = make_shared<op::Add>(a, broadcast);
+    auto f = make_shared<Function>(add, op::ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    auto folded = dynamic_pointer_cast<op::Constant>(add->get_argument(1));
+    ASSERT_NE(folded, nullptr);
+    EXPECT_EQ(folded->get_shape(), (Shape{2, 3, 2}));
+    EXPECT_EQ(folded->get_vector<float>(),
+              (vector<float>{1, 4, 2, 5, 3, 6, 1, 4, 2, 5, 3, 6}));
+}
+
+TEST(constant_folding, batch_norm_arithmetic)
+{
+    // gamma / sqrt(var + eps), as produced when folding BatchNorm into a convolution
+    auto gamma = op::Constant::create(element::f32, Shape{2}, {2, 3});
+    auto var = op::Constant::create(element::f32, Shape{2}, {3, 8});
+    auto eps = op::Constant::create(element::f32, Shape{2}, {1, 1});
+    auto scale = gamma / make_shared<op::Sqrt>(var + eps);
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto mul = a * scale;
+    auto f = make_shared<Function>(mul, op::ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    auto folded = dynamic_pointer_cast<op::Constant>(mul->get_argument(1));
+    ASSERT_NE(folded, nullptr);
+    EXPECT_EQ(folded->get_vector<float>(), (vector<float>{1, 1}));
+}
+
+TEST(constant_folding, convert_to_bfloat16)
+{
+    auto weights = op::Constant::create(element::f32, Shape{3}, {1.0f, -2.5f, 257.0f});
+    auto convert = make_shared<op::Convert>(weights, element::bf16);
+    auto a = make_shared<op::Parameter>(element::bf16, Shape{3});
+    auto add = make_shared<op::Add>(a, convert);
+    auto f = make_shared<Function>(add, op::ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    auto folded = dynamic_pointer_cast<op::Constant>(add->get_argument(1));
+    ASSERT_NE(folded, nullptr);
+    ASSERT_EQ(folded->get_element_type(), element::bf16);
+    vector<float> values;
+    for (bfloat16 value : folded->get_vector<bfloat16>())
+    {
+        values.push_back(value);
+    }
+    EXPECT_EQ(values, (vector<float>{1.0f, -2.5f, 256.0f}));
+}
+
+TEST(constant_folding, size_cap)
+{
+    auto bias = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto broadcast = make_shared<op::Broadcast>(bias, Shape{64, 4}, AxisSet{0});
+    auto a = make_shared<op::Parameter>(element::f32, Shape{64, 4});
+    auto add = make_shared<op::Add>(a, broadcast);
+    auto f = make_shared<Function>(add, op::ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(64 * 4 * sizeof(float) - 1);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(add->get_argument(1), broadcast);
+}
+
+TEST(constant_folding, integer_division_by_zero)
+{
+    auto a = op::Constant::create(element::i32, Shape{2}, {1, 2});
+    auto b = op::Constant::create(element::i32, Shape{2}, {1, 0});
+    auto div = a / b;
+    auto f = make_shared<Function>(div, op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Divide>(f), 1);
+}
+
+TEST(constant_folding, dequantize_not_folded)
+{
+    auto weights = op::Constant::create(element::i8, Shape{2}, {1, -2});
+    auto dequantize = make_shared<op::Dequantize>(weights, 0.5f, 0);
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto mul = a * dequantize;
+    auto f = make_shared<Function>(mul, op::ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(mul->get_argument(1), dequantize);
+}
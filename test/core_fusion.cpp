@@ -36,7 +36,9 @@
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
+#include "util/all_close.hpp"
 #include "util/matcher.hpp"
+#include "util/random.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -111,3 +113,53 @@ TEST(core_fusion, sparsity_opt_56x56)
     ASSERT_EQ(t_eltwise_conv1->get_window_movement_strides(), stride_1);
     ASSERT_EQ(t_eltwise_conv2->get_window_movement_strides(), stride_1);
 }
+
+static std::shared_ptr<Function> make_softmax_cross_entropy_function()
+{
+    Shape shape{4, 10};
+    auto logits = make_shared<op::Parameter>(element::f32, shape);
+    auto labels = make_shared<op::Parameter>(element::f32, shape);
+    auto softmax = make_shared<op::Softmax>(logits, AxisSet{1});
+    auto loss = -make_shared<op::Sum>(labels * make_shared<op::Log>(softmax), AxisSet{1});
+    return make_shared<Function>(loss, op::ParameterVector{logits, labels});
+}
+
+TEST(core_fusion, softmax_cross_entropy)
+{
+    auto func = make_softmax_cross_entropy_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::SoftmaxCrossEntropy>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Softmax>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Log>(func), 0);
+
+    auto ref_func = make_softmax_cross_entropy_function();
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : ref_func->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto ref_results = execute(ref_func, args, "INTERPRETER");
+    auto fused_results = execute(func, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(ref_results.at(0), fused_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+TEST(core_fusion, softmax_cross_entropy_other_axes)
+{
+    // Summing over an axis the softmax doesn't normalize isn't a cross-entropy
+    Shape shape{4, 10};
+    auto logits = make_shared<op::Parameter>(element::f32, shape);
+    auto labels = make_shared<op::Parameter>(element::f32, shape);
+    auto softmax = make_shared<op::Softmax>(logits, AxisSet{1});
+    auto loss = -make_shared<op::Sum>(labels * make_shared<op::Log>(softmax), AxisSet{0});
+    auto func = make_shared<Function>(loss, op::ParameterVector{logits, labels});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::SoftmaxCrossEntropy>(func), 0);
+}
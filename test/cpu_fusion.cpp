@@ -36,6 +36,8 @@
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
@@ -44,21 +46,31 @@
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/kernel/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_epilogue.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/fused_elementwise.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias_epilogue.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_epilogue_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quantization_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 #include "ngraph/serializer.hpp"
@@ -886,6 +898,687 @@ TEST(cpu_fusion, fuse_conv_relu)
     ASSERT_GT(cb, 0);
 }
 
+static std::shared_ptr<Function> make_quantized_conv_function(bool requantize)
+{
+    auto A = std::make_shared<op::Parameter>(element::u8, Shape{2, 1, 4, 4});
+    auto weights = std::make_shared<op::Parameter>(element::i8, Shape{2, 1, 2, 2});
+    auto dq_a = std::make_shared<op::Dequantize>(A, 0.5f, 0);
+    auto dq_weights = std::make_shared<op::Dequantize>(weights, 0.25f, 0);
+    auto conv =
+        std::make_shared<op::Convolution>(dq_a, dq_weights, Strides{1, 1}, Strides{1, 1});
+    auto relu = std::make_shared<op::Relu>(conv);
+    std::shared_ptr<Node> result = relu;
+    if (requantize)
+    {
+        result = std::make_shared<op::Quantize>(relu, 0.125f, 0, element::u8);
+    }
+    return make_shared<Function>(NodeVector{result}, op::ParameterVector{A, weights});
+}
+
+TEST(cpu_fusion, fuse_quantized_conv_relu)
+{
+    auto func = make_quantized_conv_function(true);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUQuantizationFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedConvolution>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Dequantize>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Quantize>(func), 0);
+
+    auto qconv = std::dynamic_pointer_cast<op::QuantizedConvolution>(
+        func->get_results().at(0)->get_argument(0));
+    ASSERT_NE(qconv, nullptr);
+    EXPECT_TRUE(qconv->with_relu());
+    EXPECT_EQ(qconv->get_element_type(), element::u8);
+    EXPECT_FLOAT_EQ(qconv->get_requantization_scale(), 0.5f * 0.25f / 0.125f);
+}
+
+TEST(cpu_fusion, fuse_quantized_dot)
+{
+    auto A = std::make_shared<op::Parameter>(element::u8, Shape{3, 4});
+    auto B = std::make_shared<op::Parameter>(element::i8, Shape{4, 2});
+    auto dot = std::make_shared<op::Dot>(std::make_shared<op::Dequantize>(A, 0.5f, 0),
+                                         std::make_shared<op::Dequantize>(B, 0.5f, 0));
+    auto func = make_shared<Function>(NodeVector{dot}, op::ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUQuantizationFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedDot>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(func), 0);
+}
+
+TEST(cpu_fusion, quantized_conv_relu_n2c1h4w4)
+{
+    auto int_f = make_quantized_conv_function(false);
+    auto cpu_f = make_quantized_conv_function(false);
+
+    vector<uint8_t> a(2 * 1 * 4 * 4);
+    vector<int8_t> w(2 * 1 * 2 * 2);
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a[i] = static_cast<uint8_t>((i * 37) % 256);
+    }
+    for (size_t i = 0; i < w.size(); i++)
+    {
+        w[i] = static_cast<int8_t>(static_cast<int>(i * 29 % 256) - 128);
+    }
+
+    auto run = [&](const std::shared_ptr<Function>& f, const std::string& backend_name) {
+        auto backend = runtime::Backend::create(backend_name);
+        auto a_tensor = backend->create_tensor(element::u8, Shape{2, 1, 4, 4});
+        auto w_tensor = backend->create_tensor(element::i8, Shape{2, 1, 2, 2});
+        auto result = backend->create_tensor(element::f32, Shape{2, 2, 3, 3});
+        copy_data(a_tensor, a);
+        copy_data(w_tensor, w);
+        backend->call(f, {result}, {a_tensor, w_tensor});
+        return read_vector<float>(result);
+    };
+
+    // Products of small integers scaled by powers of two are exact in f32
+    EXPECT_EQ(run(int_f, "INTERPRETER"), run(cpu_f, "CPU"));
+}
+
+TEST(cpu_fusion, quantized_conv_data_dilation_rejected)
+{
+    // MKLDNN has no dilated-data int8 convolution, so the op is left unassigned and rejected
+    auto A = std::make_shared<op::Parameter>(element::u8, Shape{1, 1, 4, 4});
+    auto weights = std::make_shared<op::Parameter>(element::i8, Shape{1, 1, 2, 2});
+    auto qconv = std::make_shared<op::QuantizedConvolution>(A,
+                                                            weights,
+                                                            Strides{1, 1},
+                                                            Strides{1, 1},
+                                                            CoordinateDiff{0, 0},
+                                                            CoordinateDiff{0, 0},
+                                                            Strides{2, 2},
+                                                            1.0f,
+                                                            element::f32);
+    auto func = make_shared<Function>(NodeVector{qconv}, op::ParameterVector{A, weights});
+    auto backend = runtime::Backend::create("CPU");
+    EXPECT_THROW(backend->compile(func), ngraph_error);
+}
+
+TEST(cpu_fusion, quantized_ops_direct_execution)
+{
+    auto make_dot_function = []() {
+        auto A = std::make_shared<op::Parameter>(element::u8, Shape{3, 4});
+        auto B = std::make_shared<op::Parameter>(element::i8, Shape{4, 2});
+        auto dot = std::make_shared<op::Dot>(std::make_shared<op::Dequantize>(A, 0.5f, 0),
+                                             std::make_shared<op::Dequantize>(B, 0.5f, 0));
+        auto quantize = std::make_shared<op::Quantize>(dot, 0.25f, 0, element::i8);
+        return make_shared<Function>(NodeVector{quantize}, op::ParameterVector{A, B});
+    };
+
+    vector<uint8_t> a{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    vector<int8_t> b{1, -1, 2, -2, 3, -3, 4, -4};
+    vector<uint8_t> conv_a(2 * 1 * 4 * 4);
+    vector<int8_t> conv_w(2 * 1 * 2 * 2);
+    for (size_t i = 0; i < conv_a.size(); i++)
+    {
+        conv_a[i] = static_cast<uint8_t>((i * 37) % 256);
+    }
+    for (size_t i = 0; i < conv_w.size(); i++)
+    {
+        conv_w[i] = static_cast<int8_t>(static_cast<int>(i * 29 % 256) - 128);
+    }
+
+    auto run = [&](const std::string& backend_name) {
+        auto backend = runtime::Backend::create(backend_name);
+        auto a_tensor = backend->create_tensor(element::u8, Shape{3, 4});
+        auto b_tensor = backend->create_tensor(element::i8, Shape{4, 2});
+        auto dot_result = backend->create_tensor(element::i8, Shape{3, 2});
+        copy_data(a_tensor, a);
+        copy_data(b_tensor, b);
+        backend->call(make_dot_function(), {dot_result}, {a_tensor, b_tensor});
+
+        auto conv_a_tensor = backend->create_tensor(element::u8, Shape{2, 1, 4, 4});
+        auto conv_w_tensor = backend->create_tensor(element::i8, Shape{2, 1, 2, 2});
+        auto conv_result = backend->create_tensor(element::u8, Shape{2, 2, 3, 3});
+        copy_data(conv_a_tensor, conv_a);
+        copy_data(conv_w_tensor, conv_w);
+        backend->call(
+            make_quantized_conv_function(true), {conv_result}, {conv_a_tensor, conv_w_tensor});
+        return make_pair(read_vector<int8_t>(dot_result), read_vector<uint8_t>(conv_result));
+    };
+
+    auto expected = run("INTERPRETER");
+    // The quantized ops built by the fusion passes run through the DEX builders
+    setenv("NGRAPH_DEX", "1", 1);
+    auto dex = run("CPU");
+    unsetenv("NGRAPH_DEX");
+    EXPECT_EQ(expected.first, dex.first);
+    EXPECT_EQ(expected.second, dex.second);
+}
+
+static std::shared_ptr<Function>
+    make_elementwise_chain_function(const Shape& shape = Shape{2, 3, 5})
+{
+    // tanh(a * b + bias) * a, with bias broadcast along the two outer axes
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, shape);
+    auto bias = std::make_shared<op::Parameter>(element::f32, Shape{shape.at(2)});
+    auto bias_broadcast = std::make_shared<op::Broadcast>(bias, shape, AxisSet{0, 1});
+    auto tanh = std::make_shared<op::Tanh>(A * B + bias_broadcast);
+    return make_shared<Function>(NodeVector{tanh * A}, op::ParameterVector{A, B, bias});
+}
+
+TEST(cpu_fusion, fuse_elementwise_chain)
+{
+    auto func = make_elementwise_chain_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(func), 0);
+    auto fused = std::static_pointer_cast<op::FusedElementwise>(
+        func->get_results().at(0)->get_argument(0));
+    EXPECT_EQ(fused->get_arguments().size(), 3);
+    EXPECT_EQ(fused->get_program().size(), 4);
+    EXPECT_EQ(fused->get_loop_shape(), (Shape{6, 5}));
+}
+
+TEST(cpu_fusion, fuse_elementwise_shared_intermediate)
+{
+    // The sum is also a function output, so it has to be materialized and ends its group
+    auto A = std::make_shared<op::Parameter>(element::f32, Shape{8});
+    auto B = std::make_shared<op::Parameter>(element::f32, Shape{8});
+    auto sum = std::make_shared<op::Add>(std::make_shared<op::Exp>(A), B);
+    auto relu = std::make_shared<op::Relu>(std::make_shared<op::Negative>(sum));
+    auto func = make_shared<Function>(NodeVector{relu, sum}, op::ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func), 2);
+    auto outer = func->get_results().at(0)->get_argument(0);
+    auto inner = func->get_results().at(1)->get_argument(0);
+    EXPECT_EQ(outer->get_argument(0), inner);
+}
+
+TEST(cpu_fusion, fuse_elementwise_implicit_broadcast)
+{
+    // A lone broadcasting add is lowered too, reading the bias with a zero stride
+    auto A = std::make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto bias = std::make_shared<op::Parameter>(element::f32, Shape{3});
+    auto add = std::make_shared<op::Add>(A, bias, op::AutoBroadcastType::NUMPY);
+    auto func = make_shared<Function>(NodeVector{add}, op::ParameterVector{A, bias});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func), 1);
+    auto fused = std::static_pointer_cast<op::FusedElementwise>(
+        func->get_results().at(0)->get_argument(0));
+    EXPECT_EQ(fused->get_broadcast_axes().at(1), (AxisSet{0}));
+    EXPECT_EQ(fused->get_input_strides().at(1), (Strides{0, 1}));
+}
+
+TEST(cpu_fusion, fused_elementwise_inter_vs_cpu)
+{
+    auto int_f = make_elementwise_chain_function();
+    auto cpu_f = make_elementwise_chain_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_f), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_fusion, fused_elementwise_direct_execution)
+{
+    // Large enough to span many blocks and be split over the thread pool
+    Shape shape{4, 33, 70};
+    auto int_f = make_elementwise_chain_function(shape);
+    auto cpu_f = make_elementwise_chain_function(shape);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    setenv("NGRAPH_DEX", "1", 1);
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    unsetenv("NGRAPH_DEX");
+    EXPECT_EQ(count_ops_of_type<op::FusedElementwise>(cpu_f), 1);
+    ASSERT_EQ(cpu_results.size(), int_results.size());
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_EQ(cpu_results.at(i).size(), shape_size(shape));
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_fusion, fuse_elementwise_skips_mkldnn_ops)
+{
+    auto A = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 4, 4});
+    auto relu =
+        std::make_shared<op::Relu>(std::make_shared<op::Exp>(std::make_shared<op::Negative>(A)));
+    auto func = make_shared<Function>(NodeVector{relu}, op::ParameterVector{A});
+
+    // As CPUAssignment marks a 4D f32 Relu
+    auto op_annotations = std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+    op_annotations->set_mkldnn_op(true);
+    relu->set_op_annotations(op_annotations);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Relu>(func), 1);
+    EXPECT_EQ(func->get_results().at(0)->get_argument(0), relu);
+    EXPECT_TRUE(std::dynamic_pointer_cast<op::FusedElementwise>(relu->get_argument(0)));
+}
+
+TEST(cpu_fusion, fused_elementwise_zero_size)
+{
+    using Opcode = op::FusedElementwise::Opcode;
+    vector<op::FusedElementwise::Instruction> program{{Opcode::Add, {0, 1}},
+                                                      {Opcode::Relu, {2}}};
+    vector<float> a{1};
+    vector<float> b{2};
+    vector<float> out{-1};
+    // Neither an empty inner nor an empty outer axis touches the buffers
+    for (auto loop_shape : {Shape{3, 0}, Shape{0, 3}})
+    {
+        runtime::cpu::kernel::fused_elementwise<float>(
+            {a.data(), b.data()}, out.data(), loop_shape, {Strides{0, 1}, Strides{0, 1}}, program);
+    }
+    EXPECT_EQ(out, vector<float>{-1});
+}
+
+static std::shared_ptr<Function> make_residual_block_function()
+{
+    // relu(conv(data, filters) + residual), as at the end of a ResNet block
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 5, 5});
+    auto filters = std::make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto residual = std::make_shared<op::Parameter>(element::f32, Shape{2, 4, 5, 5});
+    auto conv = std::make_shared<op::Convolution>(data,
+                                                  filters,
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  Strides{1, 1});
+    auto relu = std::make_shared<op::Relu>(conv + residual);
+    return make_shared<Function>(NodeVector{relu}, op::ParameterVector{data, filters, residual});
+}
+
+TEST(cpu_fusion, fuse_conv_epilogue_residual)
+{
+    auto func = make_residual_block_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func), 0);
+    auto conv = std::static_pointer_cast<op::ConvolutionBiasEpilogue>(
+        func->get_results().at(0)->get_argument(0));
+    EXPECT_TRUE(conv->has_residual());
+    EXPECT_EQ(conv->get_argument(3), func->get_parameters().at(2));
+    auto& post_ops = conv->get_post_ops();
+    ASSERT_EQ(post_ops.size(), 2);
+    EXPECT_EQ(post_ops.at(0).type, op::ConvolutionBiasEpilogue::PostOpType::Sum);
+    EXPECT_EQ(post_ops.at(1).type, op::ConvolutionBiasEpilogue::PostOpType::Relu);
+}
+
+TEST(cpu_fusion, fuse_conv_epilogue_chain)
+{
+    // Without CPUElementwiseFusion the epilogue is absorbed one consumer at a time
+    auto func = make_residual_block_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Add>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Relu>(func), 0);
+    auto conv = std::static_pointer_cast<op::ConvolutionBiasEpilogue>(
+        func->get_results().at(0)->get_argument(0));
+    EXPECT_EQ(conv->get_argument(3), func->get_parameters().at(2));
+    auto& post_ops = conv->get_post_ops();
+    ASSERT_EQ(post_ops.size(), 2);
+    EXPECT_EQ(post_ops.at(0).type, op::ConvolutionBiasEpilogue::PostOpType::Sum);
+    EXPECT_EQ(post_ops.at(1).type, op::ConvolutionBiasEpilogue::PostOpType::Relu);
+}
+
+static std::shared_ptr<Function> make_batch_norm_residual_block_function()
+{
+    // relu(batch_norm(conv(data, filters)) + residual), with inference statistics
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 5, 5});
+    auto filters = std::make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto residual = std::make_shared<op::Parameter>(element::f32, Shape{2, 4, 5, 5});
+    auto gamma = std::make_shared<op::Parameter>(element::f32, Shape{4});
+    auto beta = std::make_shared<op::Parameter>(element::f32, Shape{4});
+    auto mean = std::make_shared<op::Parameter>(element::f32, Shape{4});
+    auto var = std::make_shared<op::Parameter>(element::f32, Shape{4});
+    auto conv = std::make_shared<op::Convolution>(data,
+                                                  filters,
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  Strides{1, 1});
+    auto bn = std::make_shared<op::BatchNorm>(0.001, gamma, beta, conv, mean, var);
+    auto relu = std::make_shared<op::Relu>(bn + residual);
+    return make_shared<Function>(
+        NodeVector{relu},
+        op::ParameterVector{data, filters, residual, gamma, beta, mean, var});
+}
+
+TEST(cpu_fusion, fuse_conv_epilogue_batch_norm_residual)
+{
+    auto func = make_batch_norm_residual_block_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::BatchNorm>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(func), 1);
+    auto conv = std::static_pointer_cast<op::ConvolutionBiasEpilogue>(
+        func->get_results().at(0)->get_argument(0));
+    EXPECT_EQ(conv->get_argument(3), func->get_parameters().at(2));
+    auto& post_ops = conv->get_post_ops();
+    ASSERT_EQ(post_ops.size(), 2);
+    EXPECT_EQ(post_ops.at(0).type, op::ConvolutionBiasEpilogue::PostOpType::Sum);
+    EXPECT_EQ(post_ops.at(1).type, op::ConvolutionBiasEpilogue::PostOpType::Relu);
+}
+
+static std::shared_ptr<Function> make_scale_shift_residual_block_function()
+{
+    // max(conv(data, filters) * scale + shift + residual, 0), the way TensorFlow exports an
+    // inference batch norm in a ResNet block
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 5, 5});
+    auto filters = op::Constant::create(
+        element::f32, Shape{4, 3, 3, 3}, std::vector<float>(108, 0.25f));
+    auto residual = std::make_shared<op::Parameter>(element::f32, Shape{2, 4, 5, 5});
+    auto conv = std::make_shared<op::Convolution>(data,
+                                                  filters,
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  Strides{1, 1});
+    auto& shape = conv->get_shape();
+    auto scale = std::make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{4}, {0.5f, 1.0f, -2.0f, 3.0f}),
+        shape,
+        AxisSet{0, 2, 3});
+    auto shift = std::make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{4}, {1.0f, -1.0f, 0.0f, 0.5f}),
+        shape,
+        AxisSet{0, 2, 3});
+    auto zero = std::make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {0.0f}), shape, AxisSet{0, 1, 2, 3});
+    auto result = std::make_shared<op::Maximum>(conv * scale + shift + residual, zero);
+    return make_shared<Function>(NodeVector{result}, op::ParameterVector{data, residual});
+}
+
+TEST(cpu_fusion, fuse_conv_epilogue_scale_shift_residual)
+{
+    // The scale is folded into the filters and the shift into the bias, both at compile time
+    auto func = make_scale_shift_residual_block_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(func), 0);
+    auto conv = std::static_pointer_cast<op::ConvolutionBiasEpilogue>(
+        func->get_results().at(0)->get_argument(0));
+    auto filters = std::dynamic_pointer_cast<op::Constant>(conv->get_filters());
+    auto bias = std::dynamic_pointer_cast<op::Constant>(conv->get_bias());
+    ASSERT_TRUE(filters);
+    ASSERT_TRUE(bias);
+    EXPECT_EQ(filters->get_vector<float>().at(0), 0.125f);
+    EXPECT_EQ(filters->get_vector<float>().at(3 * 27), 0.75f);
+    EXPECT_EQ(bias->get_vector<float>(), (std::vector<float>{1.0f, -1.0f, 0.0f, 0.5f}));
+    EXPECT_EQ(conv->get_argument(3), func->get_parameters().at(1));
+    auto& post_ops = conv->get_post_ops();
+    ASSERT_EQ(post_ops.size(), 2);
+    EXPECT_EQ(post_ops.at(0).type, op::ConvolutionBiasEpilogue::PostOpType::Sum);
+    EXPECT_EQ(post_ops.at(1).type, op::ConvolutionBiasEpilogue::PostOpType::Relu);
+}
+
+static std::shared_ptr<Function> make_conv_bias_shift_scale_function()
+{
+    // (conv_bias(data, filters, bias) + per-channel shift) * 0.5 - 1
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 5, 5});
+    auto filters = std::make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto bias = std::make_shared<op::Parameter>(element::f32, Shape{4});
+    auto shift = std::make_shared<op::Parameter>(element::f32, Shape{4});
+    auto conv = std::make_shared<op::ConvolutionBias>(data,
+                                                      filters,
+                                                      bias,
+                                                      Strides{1, 1},
+                                                      Strides{1, 1},
+                                                      CoordinateDiff{0, 0},
+                                                      CoordinateDiff{0, 0},
+                                                      Strides{1, 1});
+    auto& shape = conv->get_shape();
+    auto channel_shift = std::make_shared<op::Broadcast>(shift, shape, AxisSet{0, 2, 3});
+    auto scale = std::make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {0.5f}), shape, AxisSet{0, 1, 2, 3});
+    auto one = std::make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {1.0f}), shape, AxisSet{0, 1, 2, 3});
+    auto result = (conv + channel_shift) * scale - one;
+    return make_shared<Function>(NodeVector{result},
+                                 op::ParameterVector{data, filters, bias, shift});
+}
+
+TEST(cpu_fusion, fuse_conv_epilogue_bias_and_scale)
+{
+    // The per-channel shift goes into the bias; the scale and offset, which the JIT kernels
+    // have no post-op for, are folded into the filters and the bias as well
+    auto func = make_conv_bias_shift_scale_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBias>(func), 1);
+    auto fused = func->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(std::dynamic_pointer_cast<op::ConvolutionBias>(fused));
+    EXPECT_TRUE(std::dynamic_pointer_cast<op::Multiply>(fused->get_argument(1)));
+    EXPECT_TRUE(std::dynamic_pointer_cast<op::Add>(fused->get_argument(2)));
+}
+
+TEST(cpu_fusion, fuse_conv_epilogue_unsupported_eltwise)
+{
+    // Only relu runs inside the JIT kernels, so a tanh epilogue is left alone
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 5, 5});
+    auto filters = std::make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto conv = std::make_shared<op::Convolution>(data, filters);
+    auto func = make_shared<Function>(NodeVector{std::make_shared<op::Tanh>(conv)},
+                                      op::ParameterVector{data, filters});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Convolution>(func), 1);
+}
+
+TEST(cpu_fusion, fuse_conv_epilogue_unsupported)
+{
+    // MKLDNN has no exp post-op, so the chain stays a separate pass
+    auto data = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 5, 5});
+    auto filters = std::make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+    auto conv = std::make_shared<op::Convolution>(data, filters);
+    auto func = make_shared<Function>(NodeVector{std::make_shared<op::Exp>(conv)},
+                                      op::ParameterVector{data, filters});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Convolution>(func), 1);
+}
+
+static std::shared_ptr<Function> make_matmul_epilogue_function()
+{
+    // tanh(W x + b) * gate, with b broadcast along the rows
+    auto W = std::make_shared<op::Parameter>(element::f32, Shape{6, 4});
+    auto x = std::make_shared<op::Parameter>(element::f32, Shape{4, 5});
+    auto b = std::make_shared<op::Parameter>(element::f32, Shape{5});
+    auto gate = std::make_shared<op::Parameter>(element::f32, Shape{6, 5});
+    auto b_broadcast = std::make_shared<op::Broadcast>(b, Shape{6, 5}, AxisSet{0});
+    auto dot = std::make_shared<op::Dot>(W, x);
+    auto result = std::make_shared<op::Tanh>(dot + b_broadcast) * gate;
+    return make_shared<Function>(NodeVector{result}, op::ParameterVector{W, x, b, gate});
+}
+
+TEST(cpu_fusion, fuse_matmul_epilogue)
+{
+    auto func = make_matmul_epilogue_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUElementwiseFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::MatmulBiasEpilogue>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::FusedElementwise>(func), 0);
+    auto fused = std::static_pointer_cast<op::MatmulBiasEpilogue>(
+        func->get_results().at(0)->get_argument(0));
+    EXPECT_TRUE(fused->has_bias());
+    ASSERT_EQ(fused->get_input_broadcast_axes().size(), 1);
+    EXPECT_EQ(fused->get_argument(fused->get_first_input()), func->get_parameters().at(3));
+    auto& program = fused->get_program();
+    ASSERT_EQ(program.size(), 2);
+    EXPECT_EQ(program.at(0).operands, std::vector<size_t>{0});
+    EXPECT_EQ(program.at(1).operands, (std::vector<size_t>{2, 1}));
+}
+
+TEST(cpu_fusion, fuse_matmul_epilogue_chain)
+{
+    // Extending the fused op consumer by consumer gives the same program as fusing the group
+    auto func = make_matmul_epilogue_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::MatmulBiasEpilogue>(func), 1);
+    auto fused = std::static_pointer_cast<op::MatmulBiasEpilogue>(
+        func->get_results().at(0)->get_argument(0));
+    ASSERT_EQ(fused->get_input_broadcast_axes().size(), 1);
+    EXPECT_EQ(fused->get_argument(fused->get_first_input()), func->get_parameters().at(3));
+    auto& program = fused->get_program();
+    ASSERT_EQ(program.size(), 2);
+    EXPECT_EQ(program.at(0).operands, std::vector<size_t>{0});
+    EXPECT_EQ(program.at(1).operands, (std::vector<size_t>{2, 1}));
+}
+
+TEST(cpu_fusion, conv_epilogue_fused_vs_unfused)
+{
+    for (auto make_function : {make_residual_block_function,
+                               make_batch_norm_residual_block_function,
+                               make_scale_shift_residual_block_function,
+                               make_conv_bias_shift_scale_function})
+    {
+        auto unfused = make_function();
+        auto fused = make_function();
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::CoreFusion>();
+        pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+        pass_manager.register_pass<runtime::cpu::pass::CPUEpilogueFusion>();
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(fused);
+        ASSERT_EQ(count_ops_of_type<op::Convolution>(fused), 0);
+        ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(fused) +
+                      count_ops_of_type<op::ConvolutionBias>(fused),
+                  1);
+
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : unfused->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+        // Batch norm variances must be positive
+        if (make_function == make_batch_norm_residual_block_function)
+        {
+            for (auto& v : args.at(6))
+            {
+                v = std::abs(v) + 0.1f;
+            }
+        }
+        auto unfused_results = execute(unfused, args, "INTERPRETER");
+        auto fused_results = execute(fused, args, "CPU");
+        for (size_t i = 0; i < fused_results.size(); i++)
+        {
+            EXPECT_TRUE(
+                test::all_close(fused_results.at(i), unfused_results.at(i), 1.0e-4f, 1.0e-4f));
+        }
+    }
+}
+
+TEST(cpu_fusion, epilogue_inter_vs_cpu)
+{
+    for (auto make_function : {make_residual_block_function,
+                               make_batch_norm_residual_block_function,
+                               make_scale_shift_residual_block_function,
+                               make_matmul_epilogue_function})
+    {
+        auto int_f = make_function();
+        auto cpu_f = make_function();
+
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        EXPECT_EQ(count_ops_of_type<op::ConvolutionBiasEpilogue>(cpu_f) +
+                      count_ops_of_type<op::MatmulBiasEpilogue>(cpu_f),
+                  1);
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+        }
+    }
+}
+
 TEST(cpu_fusion, conv_relu_n2c1h2w2_2)
 {
     Shape shape_a{2, 1, 6, 6};
@@ -1139,6 +1832,50 @@ TEST(cpu_fusion, weight_fusion)
               cvt_lt_conv);
 }
 
+TEST(cpu_fusion, constant_weights_reorder)
+{
+    Shape shape_data{2, 16, 8, 8};
+    Shape shape_weights{16, 16, 3, 3};
+    vector<float> weights(shape_size(shape_weights));
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        weights[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+    }
+
+    auto make_function = [&]() {
+        auto data = std::make_shared<op::Parameter>(element::f32, shape_data);
+        auto filters = op::Constant::create(element::f32, shape_weights, weights);
+        auto conv = std::make_shared<op::Convolution>(data,
+                                                      filters,
+                                                      Strides{1, 1},
+                                                      Strides{1, 1},
+                                                      CoordinateDiff{1, 1},
+                                                      CoordinateDiff{1, 1});
+        return make_shared<Function>(conv, op::ParameterVector{data});
+    };
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    vector<float> data(shape_size(shape_data));
+    rng.initialize(data);
+    args.push_back(data);
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+
+    // The weights were reordered at compile time rather than on every call
+    for (auto node : cpu_f->get_ordered_ops())
+    {
+        if (std::dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            EXPECT_FALSE(std::dynamic_pointer_cast<op::Constant>(node->get_argument(0)));
+        }
+    }
+}
+
 TEST(cpu_fusion, max_pool_with_indices)
 {
     Shape shape_a{10, 3, 28, 28};
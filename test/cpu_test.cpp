@@ -15,10 +15,17 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -31,6 +38,12 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -63,6 +76,577 @@ TEST(cpu_test, unhandled_op)
     ASSERT_THROW(backend->compile(f), ngraph_error);
 }
 
+TEST(cpu_test, mkldnn_primitive_cache_shared_across_functions)
+{
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto conv = make_shared<op::Convolution>(data, filters);
+        return make_shared<Function>(conv, op::ParameterVector{data, filters});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+
+    auto f1 = make_function();
+    backend->compile(f1);
+    size_t cached = cache.size();
+    EXPECT_GT(cached, 0u);
+
+    // An identical function reuses the primitives built for the first one
+    auto f2 = make_function();
+    backend->compile(f2);
+    EXPECT_EQ(cache.size(), cached);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto param : f1->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto expected = execute(make_function(), args, "INTERPRETER").at(0);
+    for (auto f : {f1, f2})
+    {
+        auto data = backend->create_tensor(element::f32, Shape{2, 3, 8, 8});
+        auto filters = backend->create_tensor(element::f32, Shape{4, 3, 3, 3});
+        auto result = backend->create_tensor(element::f32, Shape{2, 4, 6, 6});
+        copy_data(data, args.at(0));
+        copy_data(filters, args.at(1));
+        backend->call(f, {result}, {data, filters});
+        EXPECT_TRUE(test::all_close(read_vector<float>(result), expected, 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_test, mkldnn_primitive_cache_concurrent_calls)
+{
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto conv = make_shared<op::Convolution>(data, filters);
+        return make_shared<Function>(conv, op::ParameterVector{data, filters});
+    };
+
+    // Both call frames bind their own tensors to the one cached convolution primitive
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    auto external1 = make_shared<runtime::cpu::CPU_ExternalFunction>(make_function());
+    auto call_frame1 = external1->make_call_frame();
+    size_t cached = cache.size();
+    auto external2 = make_shared<runtime::cpu::CPU_ExternalFunction>(make_function());
+    auto call_frame2 = external2->make_call_frame();
+    EXPECT_EQ(cache.size(), cached);
+
+    auto backend = runtime::Backend::create("CPU");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<vector<float>>> args(2);
+    vector<vector<shared_ptr<runtime::TensorView>>> inputs(2);
+    vector<shared_ptr<runtime::TensorView>> results(2);
+    vector<vector<float>> expected(2);
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (const Shape& shape : {Shape{2, 3, 8, 8}, Shape{4, 3, 3, 3}})
+        {
+            vector<float> tensor_val(shape_size(shape));
+            rng.initialize(tensor_val);
+            auto input = backend->create_tensor(element::f32, shape);
+            copy_data(input, tensor_val);
+            args[i].push_back(tensor_val);
+            inputs[i].push_back(input);
+        }
+        results[i] = backend->create_tensor(element::f32, Shape{2, 4, 6, 6});
+        expected[i] = execute(make_function(), args[i], "INTERPRETER").at(0);
+    }
+
+    vector<shared_ptr<runtime::cpu::CPU_CallFrame>> call_frames{call_frame1, call_frame2};
+    vector<vector<vector<float>>> outputs(2);
+    vector<thread> threads;
+    for (size_t i = 0; i < 2; i++)
+    {
+        threads.emplace_back([&, i]() {
+            for (size_t iteration = 0; iteration < 50; iteration++)
+            {
+                call_frames[i]->call({results[i]}, inputs[i]);
+                outputs[i].push_back(read_vector<float>(results[i]));
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (auto& output : outputs[i])
+        {
+            EXPECT_TRUE(test::all_close(output, expected[i], 1.0e-4f, 1.0e-4f));
+        }
+    }
+}
+
+TEST(cpu_test, layout_propagation_through_elementwise)
+{
+    Shape shape{2, 16, 8, 8};
+    auto make_function = [&shape]() {
+        auto data = make_shared<op::Parameter>(element::f32, shape);
+        auto filters1 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto filters2 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto scale = make_shared<op::Parameter>(element::f32, shape);
+        auto conv1 = make_shared<op::Convolution>(data,
+                                                  filters1,
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1});
+        auto chain = make_shared<op::Abs>(make_shared<op::Negative>(conv1)) * scale;
+        auto conv2 = make_shared<op::Convolution>(chain,
+                                                  filters2,
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1});
+        return make_shared<Function>(conv2, op::ParameterVector{data, filters1, filters2, scale});
+    };
+    auto count_reorders = [](const shared_ptr<Function>& f) {
+        size_t count = 0;
+        for (auto node : f->get_ordered_ops())
+        {
+            if (dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+            {
+                count++;
+            }
+        }
+        return count;
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+
+    // Lay out the elementwise chain in the native format, as op-by-op assignment would
+    setenv("NGRAPH_CPU_NO_LAYOUT_PROPAGATION", "1", 1);
+    auto f_native = make_function();
+    backend->compile(f_native);
+    unsetenv("NGRAPH_CPU_NO_LAYOUT_PROPAGATION");
+
+    auto f_propagated = make_function();
+    backend->compile(f_propagated);
+    EXPECT_LT(count_reorders(f_propagated), count_reorders(f_native));
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (auto param : f_native->get_parameters())
+    {
+        auto arg = backend->create_tensor(element::f32, param->get_shape());
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto result_native = backend->create_tensor(element::f32, shape);
+    auto result_propagated = backend->create_tensor(element::f32, shape);
+    backend->call(f_native, {result_native}, args);
+    backend->call(f_propagated, {result_propagated}, args);
+    EXPECT_TRUE(test::all_close(read_vector<float>(result_native),
+                                read_vector<float>(result_propagated)));
+}
+
+TEST(cpu_test, conv_autotune_database)
+{
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{1, 16, 14, 14});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto conv = make_shared<op::Convolution>(data,
+                                                 filters,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1});
+        return make_shared<Function>(conv, op::ParameterVector{data, filters});
+    };
+    auto count_lines = [](const string& path) {
+        ifstream database(path);
+        string line;
+        size_t count = 0;
+        while (getline(database, line))
+        {
+            count++;
+        }
+        return count;
+    };
+
+    string database = file_util::path_join(file_util::get_temp_directory(), "conv_tuning.db");
+    file_util::remove_file(database);
+    setenv("NGRAPH_CPU_CONV_AUTOTUNE", database.c_str(), 1);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto f_tuned = make_function();
+    backend->compile(f_tuned);
+    size_t decisions = count_lines(database);
+    EXPECT_GT(decisions, 0u);
+
+    // A second compile finds the decision in the database instead of benchmarking again
+    auto f_retuned = make_function();
+    backend->compile(f_retuned);
+    EXPECT_EQ(count_lines(database), decisions);
+
+    unsetenv("NGRAPH_CPU_CONV_AUTOTUNE");
+    file_util::remove_file(database);
+
+    auto f_direct = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (auto param : f_direct->get_parameters())
+    {
+        auto arg = backend->create_tensor(element::f32, param->get_shape());
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto result_tuned = backend->create_tensor(element::f32, Shape{1, 16, 14, 14});
+    auto result_direct = backend->create_tensor(element::f32, Shape{1, 16, 14, 14});
+    backend->call(f_tuned, {result_tuned}, args);
+    backend->call(f_direct, {result_direct}, args);
+    EXPECT_TRUE(test::all_close(read_vector<float>(result_tuned),
+                                read_vector<float>(result_direct),
+                                1.0e-3f,
+                                1.0e-3f));
+}
+
+TEST(cpu_test, inter_op_task_scheduler)
+{
+    Shape shape{2, 8, 6, 6};
+    auto make_function = [&shape]() {
+        auto data = make_shared<op::Parameter>(element::f32, shape);
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{8, 8, 3, 3});
+        auto scale = make_shared<op::Parameter>(element::f32, shape);
+        auto conv = make_shared<op::Convolution>(data,
+                                                 filters,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1});
+        auto branch1 = make_shared<op::Relu>(conv);
+        auto branch2 = make_shared<op::Tanh>(data) * scale;
+        auto branch3 = make_shared<op::Exp>(make_shared<op::Negative>(scale));
+        auto sum = branch1 + branch2 + branch3;
+        return make_shared<Function>(NodeVector{sum, branch2},
+                                     op::ParameterVector{data, filters, scale});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto f_sequential = make_function();
+    backend->compile(f_sequential);
+
+    setenv("NGRAPH_CPU_INTER_OP_PARALLELISM", "4", 1);
+    auto external = make_shared<runtime::cpu::CPU_ExternalFunction>(make_function());
+    auto call_frame = external->make_call_frame();
+    unsetenv("NGRAPH_CPU_INTER_OP_PARALLELISM");
+    ASSERT_NE(external->get_task_graph(), nullptr);
+    EXPECT_TRUE(external->get_task_graph()->has_concurrency());
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (auto param : f_sequential->get_parameters())
+    {
+        auto arg = backend->create_tensor(element::f32, param->get_shape());
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    vector<shared_ptr<runtime::TensorView>> results_sequential{
+        backend->create_tensor(element::f32, shape), backend->create_tensor(element::f32, shape)};
+    vector<shared_ptr<runtime::TensorView>> results_scheduled{
+        backend->create_tensor(element::f32, shape), backend->create_tensor(element::f32, shape)};
+    backend->call(f_sequential, results_sequential, args);
+    for (size_t i = 0; i < 10; i++)
+    {
+        call_frame->call(results_scheduled, args);
+        for (size_t j = 0; j < results_sequential.size(); j++)
+        {
+            EXPECT_TRUE(test::all_close(read_vector<float>(results_sequential[j]),
+                                        read_vector<float>(results_scheduled[j])));
+        }
+    }
+}
+
+TEST(cpu_test, thread_pool_configure)
+{
+    auto& pool = runtime::cpu::CPUThreadPool::get();
+    size_t default_num_threads = pool.get_num_threads();
+    pool.configure(2, {0});
+    EXPECT_EQ(pool.get_num_threads(), 2u);
+    EXPECT_EQ(pool.get_affinity(), vector<int>{0});
+    EXPECT_EQ(runtime::cpu::eigen::global_thread_pool_device.numThreads(), 2);
+
+    Shape shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(A) + B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), -2.0f));
+    copy_data(b, vector<float>(shape_size(shape), 3.0f));
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 5.0f));
+
+    pool.configure(default_num_threads);
+    EXPECT_EQ(pool.get_num_threads(), default_num_threads);
+    EXPECT_TRUE(pool.get_affinity().empty());
+}
+
+TEST(cpu_test, thread_pool_affinity)
+{
+    EXPECT_EQ(runtime::cpu::CPUThreadPool::parse_cpu_list("0-2,5"), (vector<int>{0, 1, 2, 5}));
+    EXPECT_EQ(runtime::cpu::CPUThreadPool::parse_cpu_list("3"), vector<int>{3});
+    EXPECT_ANY_THROW(runtime::cpu::CPUThreadPool::parse_cpu_list("2-1"));
+    EXPECT_ANY_THROW(runtime::cpu::CPUThreadPool::parse_cpu_list("0-a"));
+
+    // With pinned threads, constants, tensors and pools are first touched by the pool
+    auto& pool = runtime::cpu::CPUThreadPool::get();
+    size_t default_num_threads = pool.get_num_threads();
+    auto default_affinity = pool.get_affinity();
+    pool.configure(2, {0});
+
+    Shape shape{32, 32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto k = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 2.0f));
+    auto f = make_shared<Function>(make_shared<op::Tanh>(A) * k + A, op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    EXPECT_EQ(read_vector<float>(a), vector<float>(shape_size(shape), 0.0f));
+    copy_data(a, vector<float>(shape_size(shape), 0.5f));
+    backend->call(f, {result}, {a});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result),
+                                vector<float>(shape_size(shape), 2.0f * tanh(0.5f) + 0.5f)));
+
+    pool.configure(default_num_threads, default_affinity);
+}
+
+TEST(cpu_test, per_call_thread_budget)
+{
+    auto& pool = runtime::cpu::CPUThreadPool::get();
+    size_t default_num_threads = pool.get_num_threads();
+    pool.configure(4);
+    atomic<int> running(0);
+    atomic<int> peak(0);
+    {
+        runtime::cpu::CPUThreadPool::ThreadLimit limit(2);
+        auto& device = runtime::cpu::eigen::get_thread_pool_device();
+        EXPECT_EQ(device.numThreads(), 2);
+        // Expensive enough for Eigen to split it into more blocks than the budget
+        device.parallelFor(64,
+                           Eigen::TensorOpCost(1e6, 1e6, 1e6),
+                           [&running, &peak](Eigen::Index first, Eigen::Index last) {
+                               int now = ++running;
+                               int previous = peak.load();
+                               while (now > previous && !peak.compare_exchange_weak(previous, now))
+                               {
+                               }
+                               this_thread::sleep_for(chrono::milliseconds(5));
+                               --running;
+                           });
+    }
+    EXPECT_GE(peak.load(), 1);
+    EXPECT_LE(peak.load(), 2);
+    EXPECT_EQ(runtime::cpu::eigen::get_thread_pool_device().numThreads(), 4);
+
+    Shape shape{16, 64};
+    auto make_function = [&shape]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Sum>(A * B, AxisSet{1}),
+                                     op::ParameterVector{A, B});
+    };
+    auto f_small = make_function();
+    auto f_large = make_function();
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = dynamic_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    ASSERT_NE(cpu_backend, nullptr);
+    cpu_backend->set_num_threads(f_small, 1);
+    cpu_backend->set_num_threads(f_large, 3);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 2.0f));
+    copy_data(b, vector<float>(shape_size(shape), 0.5f));
+    auto result_small = backend->create_tensor(element::f32, Shape{16});
+    auto result_large = backend->create_tensor(element::f32, Shape{16});
+    backend->call(f_small, {result_small}, {a, b});
+    backend->call(f_large, {result_large}, {a, b});
+    EXPECT_EQ(read_vector<float>(result_small), vector<float>(16, 64.0f));
+    EXPECT_EQ(read_vector<float>(result_large), vector<float>(16, 64.0f));
+
+    pool.configure(default_num_threads);
+}
+
+TEST(cpu_test, parallel_thresholds)
+{
+    using runtime::cpu::eigen::KernelClass;
+    namespace eigen = runtime::cpu::eigen;
+
+    auto& pool = runtime::cpu::CPUThreadPool::get();
+    size_t default_num_threads = pool.get_num_threads();
+    pool.configure(4);
+    auto kernel_classes = {KernelClass::Elementwise, KernelClass::Reduction, KernelClass::Movement};
+    vector<size_t> default_thresholds;
+    for (auto kernel_class : kernel_classes)
+    {
+        default_thresholds.push_back(eigen::get_parallel_threshold(kernel_class));
+    }
+
+    eigen::set_parallel_threshold(KernelClass::Elementwise, 1024);
+    EXPECT_EQ(eigen::get_parallel_threshold(KernelClass::Elementwise), 1024);
+    EXPECT_FALSE(eigen::use_thread_pool(KernelClass::Elementwise, 1023));
+    EXPECT_TRUE(eigen::use_thread_pool(KernelClass::Elementwise, 1024));
+    {
+        // A single thread never gains from the pool
+        runtime::cpu::CPUThreadPool::ThreadLimit limit(1);
+        EXPECT_FALSE(eigen::use_thread_pool(KernelClass::Elementwise, 1 << 20));
+    }
+
+    // Both sides of the threshold compute the same result
+    for (size_t n : {size_t{16}, size_t{4096}})
+    {
+        Eigen::Tensor<float, 1, Eigen::RowMajor> a(n);
+        Eigen::Tensor<float, 1, Eigen::RowMajor> out(n);
+        a.setConstant(1.5f);
+        eigen::evaluate(KernelClass::Elementwise, n, out, a + a);
+        EXPECT_EQ(out(n - 1), 3.0f);
+    }
+
+    // Without NGRAPH_CPU_PARALLEL_THRESHOLDS=calibrate, reconfiguring the pool keeps them
+    if (!getenv("NGRAPH_CPU_PARALLEL_THRESHOLDS"))
+    {
+        pool.configure(2);
+        EXPECT_EQ(eigen::get_parallel_threshold(KernelClass::Elementwise), 1024);
+    }
+
+    // Calibration settles on a size it measured, and leaves a single thread serial
+    eigen::calibrate_parallel_thresholds();
+    for (auto kernel_class : kernel_classes)
+    {
+        size_t threshold = eigen::get_parallel_threshold(kernel_class);
+        EXPECT_GE(threshold, size_t{256});
+        EXPECT_LE(threshold, size_t{1} << 22);
+        EXPECT_EQ(threshold & (threshold - 1), size_t{0});
+    }
+    pool.configure(1);
+    eigen::calibrate_parallel_thresholds();
+    EXPECT_EQ(eigen::get_parallel_threshold(KernelClass::Reduction),
+              numeric_limits<size_t>::max());
+
+    pool.configure(default_num_threads);
+    size_t i = 0;
+    for (auto kernel_class : kernel_classes)
+    {
+        eigen::set_parallel_threshold(kernel_class, default_thresholds[i++]);
+    }
+}
+
+TEST(cpu_test, micro_batches)
+{
+    Shape shape{8, 4};
+    auto make_function = [&shape]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W = make_shared<op::Parameter>(element::f32, shape);
+        auto bias = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+        auto sum = A * W + make_shared<op::Broadcast>(bias, shape, AxisSet{0});
+        return make_shared<Function>(make_shared<op::Softmax>(sum, AxisSet{1}),
+                                     op::ParameterVector{A, W});
+    };
+    auto f = make_function();
+    auto f_sliced = make_function();
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = dynamic_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    ASSERT_NE(cpu_backend, nullptr);
+    cpu_backend->set_micro_batches(f_sliced, 4);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto w = backend->create_tensor(element::f32, shape);
+    copy_data(a, test::NDArray<float, 2>({{1, 2, 3, 4},
+                                          {0, 1, 0, 1},
+                                          {4, 3, 2, 1},
+                                          {-1, -2, -3, -4},
+                                          {1, 1, 1, 1},
+                                          {2, 0, 2, 0},
+                                          {0, 0, 0, 0},
+                                          {3, 1, 4, 1}})
+                     .get_vector());
+    copy_data(w, vector<float>(shape_size(shape), 0.5f));
+    auto result = backend->create_tensor(element::f32, shape);
+    auto result_sliced = backend->create_tensor(element::f32, shape);
+    backend->call(f, {result}, {a, w});
+    backend->call(f_sliced, {result_sliced}, {a, w});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), read_vector<float>(result_sliced)));
+
+    // A batch of 5 splits into slices of 2 and 3 entries; the filters are constants so that only
+    // the data is sliced
+    Shape data_shape{5, 3, 8, 8};
+    Shape result_shape{5, 4, 6, 6};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> filter_values(4 * 3 * 3 * 3);
+    for (size_t i = 0; i < filter_values.size(); i++)
+    {
+        filter_values[i] = static_cast<float>(i % 7) / 7.0f - 0.5f;
+    }
+    auto make_conv_function = [&]() {
+        auto data = make_shared<op::Parameter>(element::f32, data_shape);
+        auto filters = op::Constant::create(element::f32, Shape{4, 3, 3, 3}, filter_values);
+        auto conv = make_shared<op::Convolution>(data, filters);
+        return make_shared<Function>(make_shared<op::Relu>(conv), op::ParameterVector{data});
+    };
+    auto f_conv = make_conv_function();
+    auto f_conv_sliced = make_conv_function();
+    cpu_backend->set_micro_batches(f_conv_sliced, 2);
+
+    auto data = backend->create_tensor(element::f32, data_shape);
+    rng.initialize(data);
+    auto conv_result = backend->create_tensor(element::f32, result_shape);
+    auto conv_result_sliced = backend->create_tensor(element::f32, result_shape);
+    backend->call(f_conv, {conv_result}, {data});
+    backend->call(f_conv_sliced, {conv_result_sliced}, {data});
+    EXPECT_TRUE(test::all_close(read_vector<float>(conv_result),
+                                read_vector<float>(conv_result_sliced)));
+
+    // A softmax over the batch axis mixes its entries
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f_mixed =
+        make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{0}), op::ParameterVector{A});
+    cpu_backend->set_micro_batches(f_mixed, 2);
+    EXPECT_THROW(backend->call(f_mixed, {result}, {a}), ngraph_error);
+}
+
+TEST(cpu_test, micro_batch_slices_own_primitives)
+{
+    auto make_function = [](size_t batch) {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{batch, 3, 8, 8});
+        auto filters = op::Constant::create(element::f32, Shape{4, 3, 3, 3}, vector<float>(108, 1));
+        auto conv = make_shared<op::Convolution>(data, filters);
+        return make_shared<Function>(conv, op::ParameterVector{data});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = dynamic_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    ASSERT_NE(cpu_backend, nullptr);
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+
+    size_t cached = cache.size();
+    backend->compile(make_function(3));
+    size_t per_function = cache.size() - cached;
+    EXPECT_GT(per_function, 0u);
+
+    // Both slices have the shapes of the function above, but slices run concurrently and must
+    // not lock each other's primitives: the first slice reuses the cached primitives and the
+    // second one builds its own
+    cached = cache.size();
+    auto f_sliced = make_function(6);
+    cpu_backend->set_micro_batches(f_sliced, 2);
+    backend->compile(f_sliced);
+    EXPECT_EQ(cache.size() - cached, per_function);
+}
+
 #ifdef NGRAPH_TBB_ENABLE
 TEST(cpu_test, abc_tbb)
 {
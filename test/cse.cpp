@@ -27,6 +27,7 @@
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -220,3 +221,65 @@ TEST(CSE, reduction_ops)
     execute_cse_reduction_test<op::Sum>();
     execute_cse_reduction_test<op::Product>();
 }
+
+TEST(CSE, subtract_not_commutative)
+{
+    Shape shape{2};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, shape);
+    auto sub1 = std::make_shared<op::Subtract>(A, B);
+    auto sub2 = std::make_shared<op::Subtract>(B, A);
+    auto f = std::make_shared<Function>(NodeVector{sub1, sub2}, op::ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), sub1);
+    ASSERT_EQ(f->get_results().at(1)->get_argument(0), sub2);
+}
+
+TEST(CSE, constants)
+{
+    Shape shape{2, 2};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto c1 = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto c2 = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto c3 = op::Constant::create(element::f32, shape, {1, 2, 3, 5});
+    auto c4 = op::Constant::create(element::i32, shape, {1, 2, 3, 4});
+    auto c5 = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto add1 = std::make_shared<op::Add>(A, c1);
+    auto add2 = std::make_shared<op::Add>(A, c2);
+    auto add3 = std::make_shared<op::Add>(A, c3);
+    auto f = std::make_shared<Function>(NodeVector{add1, add2, add3, c4, c5},
+                                        op::ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    // Equal constants are merged, and so are the expressions that use them
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(add1->get_argument(1), add2->get_argument(1));
+    // Different values, element types or shapes are kept apart
+    ASSERT_EQ(add3->get_argument(1), c3);
+    ASSERT_EQ(f->get_results().at(2)->get_argument(0), add3);
+    ASSERT_EQ(f->get_results().at(3)->get_argument(0), c4);
+    ASSERT_EQ(f->get_results().at(4)->get_argument(0), c5);
+}
+
+TEST(CSE, slice_attributes)
+{
+    auto A = std::make_shared<op::Parameter>(element::f32, Shape{4, 4});
+    auto slice1 = std::make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 2});
+    auto slice2 = std::make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 2});
+    auto slice3 = std::make_shared<op::Slice>(A, Coordinate{2, 2}, Coordinate{4, 4});
+    auto f =
+        std::make_shared<Function>(NodeVector{slice1, slice2, slice3}, op::ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(2)->get_argument(0), slice3);
+}
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
 #include <map>
 
 #include "gtest/gtest.h"
@@ -36,6 +37,8 @@ TEST(element_type, from)
     EXPECT_EQ(element::from<uint16_t>(), element::u16);
     EXPECT_EQ(element::from<uint32_t>(), element::u32);
     EXPECT_EQ(element::from<uint64_t>(), element::u64);
+    EXPECT_EQ(element::from<float16>(), element::f16);
+    EXPECT_EQ(element::from<bfloat16>(), element::bf16);
 }
 
 TEST(element_type, mapable)
@@ -43,6 +46,40 @@ TEST(element_type, mapable)
     std::map<element::Type, std::string> test_map;
 
     test_map.insert({element::f32, "float"});
+    test_map.insert({element::f16, "float16"});
+    test_map.insert({element::bf16, "bfloat16"});
+    EXPECT_EQ(3, test_map.size());
+    EXPECT_NE(element::f16, element::bf16);
+    EXPECT_EQ(2, element::f16.size());
+    EXPECT_EQ(2, element::bf16.size());
+}
+
+TEST(element_type, float16_conversion)
+{
+    EXPECT_EQ(0x3C00, float16(1.0f).to_bits());
+    EXPECT_EQ(0xC000, float16(-2.0f).to_bits());
+    EXPECT_EQ(0x7BFF, float16(65504.0f).to_bits());
+    EXPECT_EQ(0x7C00, float16(1.0e6f).to_bits());
+    EXPECT_EQ(0x0001, float16(5.9604645e-8f).to_bits());
+    // 1 + 2^-11 is exactly halfway between two half values and rounds to even
+    EXPECT_EQ(0x3C00, float16(1.00048828125f).to_bits());
+    EXPECT_FLOAT_EQ(0.333251953125f, static_cast<float>(float16(1.0f / 3.0f)));
+    EXPECT_FLOAT_EQ(6.1035156e-5f, static_cast<float>(std::numeric_limits<float16>::min()));
+    EXPECT_TRUE(std::isnan(static_cast<float>(float16(NAN))));
+    EXPECT_TRUE(std::isinf(static_cast<float>(float16(-INFINITY))));
+}
+
+TEST(element_type, bfloat16_conversion)
+{
+    EXPECT_EQ(0x3F80, bfloat16(1.0f).to_bits());
+    EXPECT_EQ(0xC000, bfloat16(-2.0f).to_bits());
+    // 1 + 2^-8 is exactly halfway between two bfloat16 values and rounds to even
+    EXPECT_EQ(0x3F80, bfloat16(1.00390625f).to_bits());
+    EXPECT_EQ(0x3F82, bfloat16(1.01171875f).to_bits());
+    EXPECT_FLOAT_EQ(3.140625f, static_cast<float>(bfloat16(3.14159f)));
+    EXPECT_FLOAT_EQ(3.3895314e38f, static_cast<float>(std::numeric_limits<bfloat16>::max()));
+    EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(NAN))));
+    EXPECT_TRUE(std::isinf(static_cast<float>(bfloat16(INFINITY))));
 }
 
 TEST(element_type, size)
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(mixed_precision, dot_chain)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    auto w1 = make_shared<op::Parameter>(element::f32, Shape{8, 8});
+    auto w2 = make_shared<op::Parameter>(element::f32, Shape{8, 2});
+    auto dot1 = make_shared<op::Dot>(a, w1);
+    auto dot2 = make_shared<op::Dot>(dot1, w2);
+    auto sum = make_shared<op::Sum>(dot2, AxisSet{1});
+    auto f = make_shared<Function>(sum, op::ParameterVector{a, w1, w2});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>(element::bf16);
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 2);
+    for (auto node : f->get_ordered_ops())
+    {
+        if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+        {
+            EXPECT_EQ(dot->get_element_type(), element::bf16);
+        }
+    }
+    // Three parameters enter bf16 and one result leaves it; the pair between the dots cancels
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 4);
+
+    // The reduction stays in f32
+    ASSERT_EQ(sum->get_element_type(), element::f32);
+    auto convert = dynamic_pointer_cast<op::Convert>(sum->get_argument(0));
+    ASSERT_NE(convert, nullptr);
+    ASSERT_EQ(convert->get_argument(0)->get_element_type(), element::bf16);
+}
+
+TEST(mixed_precision, sensitive_ops_unchanged)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto exp = make_shared<op::Exp>(a);
+    auto softmax = make_shared<op::Softmax>(exp, AxisSet{1});
+    auto log = make_shared<op::Log>(softmax);
+    auto f = make_shared<Function>(log, op::ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>(element::f16);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    ASSERT_EQ(log->get_argument(0), softmax);
+}
+
+TEST(mixed_precision, custom_op_set)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<op::Add>(a, b);
+    auto dot = make_shared<op::Dot>(add, b);
+    auto f = make_shared<Function>(dot, op::ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>(element::f16, set<string>{"Add"});
+    pass_manager.run_passes(f);
+
+    auto convert = dynamic_pointer_cast<op::Convert>(dot->get_argument(0));
+    ASSERT_NE(convert, nullptr);
+    EXPECT_EQ(convert->get_argument(0)->get_element_type(), element::f16);
+    EXPECT_EQ(dot->get_element_type(), element::f32);
+}
+
+TEST(mixed_precision, invalid_type)
+{
+    EXPECT_THROW(pass::MixedPrecision(element::i8), ngraph_error);
+}
@@ -23,7 +23,10 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -59,3 +62,39 @@ TEST(pass_manager, module_add_function)
                                        make_shared<op::FunctionCall>(f, NodeVector{X, Y, Z}),
                                    op::ParameterVector{X, Y, Z});
 }
+
+TEST(pass_manager, pass_profiling)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto C = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto f = make_shared<Function>(A * (B + C), op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+
+    const vector<pass::PassStatistics>& statistics =
+        pass_manager.get_state().get_pass_statistics();
+    ASSERT_EQ(statistics.size(), 3);
+    EXPECT_NE(statistics[0].name().find("ConstantFolding"), string::npos);
+    // A, B, C, Add, Multiply, Result become A, Constant, Multiply, Result
+    EXPECT_EQ(statistics[0].nodes_before(), 6);
+    EXPECT_EQ(statistics[0].nodes_after(), 4);
+    EXPECT_EQ(statistics[2].pool_size_before(), 0);
+    EXPECT_EQ(statistics[2].pool_size_after(), f->get_temporary_pool_size());
+}
+
+TEST(pass_manager, pass_profiling_disabled)
+{
+    auto graph = make_test_graph();
+    pass::Manager pass_manager;
+    pass_manager.set_pass_profiling(false);
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(graph);
+    EXPECT_TRUE(pass_manager.get_state().get_pass_statistics().empty());
+}
@@ -236,3 +236,50 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, in_place)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, true);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto neg_a = make_shared<op::Negative>(A);
+    auto neg_b = make_shared<op::Negative>(B);
+    auto add = make_shared<op::Add>(neg_a, neg_b);
+    auto op_annotations = make_shared<op::util::OpAnnotations>();
+    op_annotations->add_in_place_oi_pair({0, 1});
+    add->set_op_annotations(op_annotations);
+    auto f = make_shared<Function>(make_shared<op::Abs>(add), op::ParameterVector{A, B});
+
+    pass_manager.run_passes(f);
+    EXPECT_EQ(add->get_output_tensor(0).get_pool_offset(),
+              neg_b->get_output_tensor(0).get_pool_offset());
+    EXPECT_NE(add->get_output_tensor(0).get_pool_offset(),
+              neg_a->get_output_tensor(0).get_pool_offset());
+    // neg_a, neg_b (shared with add) and abs
+    EXPECT_EQ(48, f->get_temporary_pool_size());
+}
+
+TEST(memory_layout, in_place_shared_input)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, true);
+
+    // The input feeds both arguments, so writing over it would clobber the other one
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto neg_a = make_shared<op::Negative>(A);
+    auto add = make_shared<op::Add>(neg_a, neg_a);
+    auto op_annotations = make_shared<op::util::OpAnnotations>();
+    op_annotations->add_in_place_oi_pair({0, 0});
+    add->set_op_annotations(op_annotations);
+    auto f = make_shared<Function>(make_shared<op::Abs>(add), op::ParameterVector{A});
+
+    pass_manager.run_passes(f);
+    EXPECT_NE(add->get_output_tensor(0).get_pool_offset(),
+              neg_a->get_output_tensor(0).get_pool_offset());
+}
@@ -731,6 +731,109 @@ TEST(pattern, recurrent_graph_rewrite)
     }
 }
 
+// Collapses chains of Abs into their innermost Abs and counts the Abs nodes it is offered
+class TestAbsChainRewrite : public ngraph::pass::RecurrentGraphRewrite
+{
+public:
+    TestAbsChainRewrite(size_t& visits)
+        : RecurrentGraphRewrite()
+    {
+        auto rpattern = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+        auto abs = std::make_shared<op::Abs>(rpattern);
+        ngraph::pattern::recurrent_graph_rewrite_callback callback = [rpattern, &visits](
+            pattern::RecurrentMatcher& rm) {
+            visits++;
+            auto number_of_abs = rm.get_number_of_recurrent_matches();
+            if (number_of_abs < 2)
+            {
+                return false;
+            }
+            // The argument of the second to last Abs of the chain is the innermost Abs
+            auto innermost = rm.get_bound_nodes_for_pattern(rpattern).at(number_of_abs - 2);
+            ngraph::replace_node(rm.get_match_root(), innermost);
+            return true;
+        };
+        std::set<std::shared_ptr<pattern::op::Label>> empty_correlated_matches;
+        this->add_matcher(std::make_shared<pattern::RecurrentMatcher>(
+            abs, rpattern, empty_correlated_matches, callback));
+    }
+};
+
+TEST(pattern, recurrent_graph_rewrite_revisits_neighborhood)
+{
+    // abs(abs(abs(a))) followed by a tail of abs(-x). The ops are offered from the result
+    // backwards, so the tail has been visited when the chain collapses.
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto abs1 = std::make_shared<op::Abs>(a);
+    auto chain = std::make_shared<op::Abs>(std::make_shared<op::Abs>(abs1));
+    std::shared_ptr<Node> tail = chain;
+    const size_t tail_length = 20;
+    for (size_t i = 0; i < tail_length; i++)
+    {
+        tail = std::make_shared<op::Abs>(std::make_shared<op::Negative>(tail));
+    }
+    auto f = std::make_shared<Function>(ngraph::NodeVector{tail}, op::ParameterVector{a});
+
+    size_t visits = 0;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<TestAbsChainRewrite>(visits);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Abs>(f), tail_length + 1);
+    // Every Abs is offered once, and only the replacement is offered again. Revisiting the
+    // users of the collapsed chain transitively would offer the whole tail twice.
+    EXPECT_EQ(visits, tail_length + 2);
+}
+
+class TestIndexedGraphRewrite : public ngraph::pass::GraphRewrite
+{
+public:
+    TestIndexedGraphRewrite()
+        : GraphRewrite()
+    {
+        // Rooted at op::Negative: -(-x) => x
+        auto x = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+        auto neg_neg = std::make_shared<op::Negative>(std::make_shared<op::Negative>(x));
+        ngraph::pattern::graph_rewrite_callback neg_callback = [x](pattern::Matcher& m) {
+            ngraph::replace_node(m.get_match_root(), m.get_pattern_map()[x]);
+            return true;
+        };
+        this->add_matcher(std::make_shared<pattern::Matcher>(neg_neg, neg_callback));
+
+        // Rooted at a Label, so offered every node: abs(abs(x)) => abs(x)
+        auto is_abs_abs = [](std::shared_ptr<Node> n) {
+            return std::dynamic_pointer_cast<op::Abs>(n) &&
+                   std::dynamic_pointer_cast<op::Abs>(n->get_argument(0));
+        };
+        auto any_abs = std::make_shared<pattern::op::Label>(element::i32, Shape{}, is_abs_abs);
+        ngraph::pattern::graph_rewrite_callback abs_callback = [](pattern::Matcher& m) {
+            ngraph::replace_node(m.get_match_root(), m.get_match_root()->get_argument(0));
+            return true;
+        };
+        this->add_matcher(std::make_shared<pattern::Matcher>(any_abs, abs_callback));
+    }
+};
+
+TEST(pattern, graph_rewrite_indexed_matchers)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto abs1 = std::make_shared<op::Abs>(a);
+    auto abs2 = std::make_shared<op::Abs>(abs1);
+    auto neg1 = std::make_shared<op::Negative>(abs2);
+    auto neg2 = std::make_shared<op::Negative>(neg1);
+    auto graph = std::make_shared<op::Sign>(neg2);
+    auto f = std::make_shared<Function>(ngraph::NodeVector{graph}, op::ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<TestIndexedGraphRewrite>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(graph->get_argument(0), abs1);
+    ASSERT_EQ(abs1->get_argument(0), a);
+}
+
 TEST(pattern, label_on_skip)
 {
     Shape shape{2, 2};
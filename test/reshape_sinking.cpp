@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <functional>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/reshape_sinking.hpp"
+#include "util/all_close.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Builds the graph twice, sinks the reshapes in one copy and checks that both compute the
+// same values. Returns the number of Reshapes left in the optimized copy.
+static size_t sink_and_compare(function<shared_ptr<Function>()> make_function)
+{
+    auto f_ref = make_function();
+    auto f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeSinking>();
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : f->get_parameters())
+    {
+        vector<float> arg(shape_size(param->get_shape()));
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto ref_results = execute(f_ref, args, "INTERPRETER");
+    auto results = execute(f, args, "INTERPRETER");
+    EXPECT_EQ(ref_results.size(), results.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(ref_results.at(i), results.at(i)));
+    }
+    return count_ops_of_type<op::Reshape>(f);
+}
+
+TEST(reshape_sinking, inverse_pair_through_elementwise)
+{
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+        auto t1 = make_shared<op::Reshape>(a, AxisVector{2, 0, 1}, Shape{4, 2, 3});
+        auto relu = make_shared<op::Relu>(make_shared<op::Negative>(t1));
+        auto t2 = make_shared<op::Reshape>(relu, AxisVector{1, 2, 0}, Shape{2, 3, 4});
+        return make_shared<Function>(t2, op::ParameterVector{a});
+    };
+    EXPECT_EQ(sink_and_compare(make_function), 0);
+}
+
+TEST(reshape_sinking, binary_with_constant)
+{
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto t1 = make_shared<op::Reshape>(a, AxisVector{1, 0}, Shape{3, 2});
+        auto c = op::Constant::create(element::f32, Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+        auto scalar = op::Constant::create(element::f32, Shape{}, {2});
+        auto two = make_shared<op::Broadcast>(scalar, Shape{3, 2}, AxisSet{0, 1});
+        auto sum = (t1 + c) * two;
+        auto t2 = make_shared<op::Reshape>(sum, AxisVector{1, 0}, Shape{2, 3});
+        return make_shared<Function>(t2, op::ParameterVector{a});
+    };
+    EXPECT_EQ(sink_and_compare(make_function), 0);
+}
+
+TEST(reshape_sinking, merge_consecutive)
+{
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+        auto t1 = make_shared<op::Reshape>(a, AxisVector{2, 0, 1}, Shape{4, 2, 3});
+        auto t2 = make_shared<op::Reshape>(t1, AxisVector{0, 2, 1}, Shape{4, 3, 2});
+        return make_shared<Function>(make_shared<op::Abs>(t2), op::ParameterVector{a});
+    };
+    EXPECT_EQ(sink_and_compare(make_function), 1);
+}
+
+TEST(reshape_sinking, broadcast_and_slice)
+{
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+        auto t1 = make_shared<op::Reshape>(a, AxisVector{2, 0, 1}, Shape{4, 2, 3});
+        auto slice = make_shared<op::Slice>(t1, Coordinate{1, 0, 1}, Coordinate{4, 2, 3});
+        auto broadcast = make_shared<op::Broadcast>(slice, Shape{3, 2, 5, 2}, AxisSet{2});
+        return make_shared<Function>(broadcast, op::ParameterVector{a});
+    };
+    EXPECT_EQ(sink_and_compare(make_function), 1);
+}
+
+TEST(reshape_sinking, mismatched_binary)
+{
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto b = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+        auto t1 = make_shared<op::Reshape>(a, AxisVector{1, 0}, Shape{3, 2});
+        auto dot = make_shared<op::Dot>(a, t1 + b);
+        return make_shared<Function>(dot, op::ParameterVector{a, b});
+    };
+    EXPECT_EQ(sink_and_compare(make_function), 1);
+}
+
+TEST(reshape_sinking, shared_transpose)
+{
+    // One consumer absorbs the transpose, the other needs it materialized
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto t1 = make_shared<op::Reshape>(a, AxisVector{1, 0}, Shape{3, 2});
+        auto neg = make_shared<op::Negative>(t1);
+        auto t2 = make_shared<op::Reshape>(neg, AxisVector{1, 0}, Shape{2, 3});
+        auto dot = make_shared<op::Dot>(t1, a);
+        return make_shared<Function>(NodeVector{t2, dot}, op::ParameterVector{a});
+    };
+    EXPECT_EQ(sink_and_compare(make_function), 1);
+}
+
+TEST(reshape_sinking, softmax)
+{
+    // The softmax axes follow the transpose instead of staying on the same positions
+    auto make_function = []() {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+        auto t1 = make_shared<op::Reshape>(a, AxisVector{2, 0, 1}, Shape{4, 2, 3});
+        auto softmax = make_shared<op::Softmax>(t1, AxisSet{0, 2});
+        auto t2 = make_shared<op::Reshape>(softmax, AxisVector{1, 2, 0}, Shape{2, 3, 4});
+        return make_shared<Function>(t2, op::ParameterVector{a});
+    };
+    EXPECT_EQ(sink_and_compare(make_function), 0);
+}
@@ -173,3 +173,19 @@ TEST(benchmark, serialize)
     timer.stop();
     cout << "deserialize took " << timer.get_milliseconds() << "ms\n";
 }
+
+TEST(serialize, auto_broadcast)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto add = make_shared<op::Add>(A, B, op::AutoBroadcastType::NUMPY);
+    auto f = make_shared<Function>(add, op::ParameterVector{A, B});
+
+    string js = serialize(f);
+    auto g = deserialize(js);
+    ASSERT_NE(g, nullptr);
+    auto g_add = dynamic_pointer_cast<op::Add>(g->get_results().at(0)->get_argument(0));
+    ASSERT_NE(g_add, nullptr);
+    EXPECT_EQ(g_add->get_autob(), op::AutoBroadcastType::NUMPY);
+    EXPECT_EQ(g_add->get_shape(), (Shape{2, 3}));
+}
@@ -686,6 +686,48 @@ TEST(type_prop, comparison_good)
     EXPECT_EQ(eq->get_shape(), (Shape{2, 4}));
 }
 
+TEST(type_prop, binary_numpy_broadcast)
+{
+    auto param_0 = make_shared<op::Parameter>(element::f32, Shape{2, 1, 4});
+    auto param_1 = make_shared<op::Parameter>(element::f32, Shape{3, 1});
+    auto add = make_shared<op::Add>(param_0, param_1, op::AutoBroadcastType::NUMPY);
+    EXPECT_EQ(add->get_shape(), (Shape{2, 3, 4}));
+    EXPECT_TRUE(add->is_implicitly_broadcast());
+
+    auto less = make_shared<op::Less>(param_1, param_0, op::AutoBroadcastType::NUMPY);
+    EXPECT_EQ(less->get_element_type(), element::boolean);
+    EXPECT_EQ(less->get_shape(), (Shape{2, 3, 4}));
+
+    auto scalar = make_shared<op::Parameter>(element::f32, Shape{});
+    auto mul = make_shared<op::Multiply>(scalar, param_0, op::AutoBroadcastType::NUMPY);
+    EXPECT_EQ(mul->get_shape(), (Shape{2, 1, 4}));
+}
+
+TEST(type_prop, binary_numpy_broadcast_bad_shapes)
+{
+    auto param_0 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto param_1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    try
+    {
+        auto add = make_shared<op::Add>(param_0, param_1, op::AutoBroadcastType::NUMPY);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Incompatible broadcast shapes not detected.";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(),
+                  std::string("Argument shapes [ 2, 3 ] and [ 2 ] are not broadcast-compatible"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+
+    // Without auto broadcasting the shapes must match exactly
+    auto param_2 = make_shared<op::Parameter>(element::f32, Shape{1, 3});
+    EXPECT_THROW(make_shared<op::Add>(param_0, param_2), ngraph_error);
+}
+
 TEST(type_prop, binary_arithmetic_bad_argument_element_types)
 {
     auto tv0_2_4_param_0 = make_shared<op::Parameter>(element::boolean, Shape{2, 4});